@@ -26,5 +26,27 @@
 #include "include/Core2048_Utils.h"
 #include "include/GameCore.h"
 #include "include/Block.h"
+#include "include/Arena.h"
+#include "include/BatchSimulator.h"
+#include "include/BitBoard.h"
+#include "include/BitBoardGameCore.h"
+#include "include/CountedRandom.h"
+#include "include/CounterRandom.h"
+#include "include/GameRecord.h"
+#include "include/GameRecordArchive.h"
+#include "include/GameRecordReader.h"
+#include "include/GameRecordWriter.h"
+#include "include/LineKernel.h"
+#include "include/LineTable.h"
 #include "include/IValuesGenerator.h"
 #include "include/PresetValuesGenerator.h"
+#include "include/Random.h"
+#include "include/ReplayVerifier.h"
+#include "include/SessionHost.h"
+#include "include/Solver.h"
+#include "include/StaticGameCore.h"
+#include "include/StaticValuesGenerator.h"
+#include "include/ThreadPool.h"
+#include "include/TranspositionTable.h"
+#include "include/ValuesTable.h"
+#include "include/Zobrist.h"
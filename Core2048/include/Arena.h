@@ -0,0 +1,270 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Arena.h                                                       //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Slab pool of memory for the games and its std allocator.                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Memory of many games that is released at once.
+/// @detail
+///   Memory is taken from big chunks in size classes of powers of 2,
+///   starting at k_min_size bytes. Freed memory goes to the free list
+///   of its class and is given again to the next allocation of that
+///   class, so games that come and go reuse the same memory and the
+///   arena stops growing once it holds the most memory that was alive
+///   at once.                                                           \n
+///   reset() releases everything at once and keeps the chunks, so a
+///   session can start over without going to the heap. The chunks are
+///   only given back to the heap when the arena is destroyed.          \n
+///   It isn't thread safe, each game or thread must have its own arena.
+/// @see ArenaAllocator, GameCore.
+class Arena
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The default size of the chunks, bigger allocations take
+    ///    a chunk of theirs own size.
+    static constexpr std::size_t k_default_chunk_size = 64 * 1024;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The smallest class, it's the alignment of all allocations.
+    static constexpr std::size_t k_min_size = 16;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+private:
+    struct FreeNode
+    {
+        FreeNode *p_next;
+    };
+
+    struct Chunk
+    {
+        std::unique_ptr<u8[]> p_memory;
+        std::size_t           size;
+    };
+
+    // One free list for each power of 2 starting at k_min_size.
+    static constexpr u32 k_classes_count = 64 - 4;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs an empty arena, nothing is allocated until
+    ///    the first allocate().
+    explicit Arena(std::size_t chunk_size = k_default_chunk_size) noexcept;
+
+    Arena(const Arena &) = delete;
+    Arena& operator=(const Arena &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Allocates size bytes aligned to k_min_size.
+    /// @see deallocate().
+    void* allocate(std::size_t size) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gives back the memory of an allocate() of the same size.
+    /// @see allocate().
+    void deallocate(void *p_memory, std::size_t size) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Releases all the allocations at once, the chunks are kept.
+    /// @note
+    ///    Nothing allocated by the arena can be used after it, so the
+    ///    games that use the arena must be destroyed before.
+    void reset() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many bytes are allocated and not deallocated,
+    ///    rounded up to theirs classes.
+    inline std::size_t
+    get_used_size() const noexcept
+    {
+        return m_used_size;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many bytes the chunks take.
+    inline std::size_t
+    get_chunks_size() const noexcept
+    {
+        return m_chunks_size;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    static inline u32
+    get_class(std::size_t size) noexcept
+    {
+        if(size <= k_min_size)
+            return 0;
+
+        return u32(64 - __builtin_clzll(u64(size) -1)) - 4;
+    }
+
+    static constexpr inline std::size_t
+    get_class_size(u32 size_class) noexcept
+    {
+        return k_min_size << size_class;
+    }
+
+    u8* allocate_from_chunks(std::size_t size) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::size_t m_chunk_size;
+
+    // The chunks before m_chunk_index are taken, the memory of the
+    // current chunk is taken up to m_chunk_offset.
+    std::vector<Chunk> m_chunks;
+    u32                m_chunk_index;
+    std::size_t        m_chunk_offset;
+    std::size_t        m_chunks_size;
+
+    FreeNode    *m_free_lists[k_classes_count];
+    std::size_t  m_used_size;
+
+}; // class Arena
+
+
+///-----------------------------------------------------------------------------
+/// @brief The std allocator of an Arena.
+/// @detail
+///   Without an arena the memory comes from the heap, like with
+///   std::allocator. Copies of containers keep the arena of the original.
+/// @see Arena.
+template <typename T>
+class ArenaAllocator
+{
+    static_assert(
+        alignof(T) <= Arena::k_min_size,
+        "The arena doesn't align to more than Arena::k_min_size."
+    );
+
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef T value_type;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    inline explicit
+    ArenaAllocator(Arena *p_arena = nullptr) noexcept
+        : mp_arena(p_arena)
+    {
+        // Empty...
+    }
+
+    template <typename U>
+    inline
+    ArenaAllocator(const ArenaAllocator<U> &other) noexcept
+        : mp_arena(other.get_arena())
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    inline T*
+    allocate(std::size_t count) noexcept
+    {
+        auto size = count * sizeof(T);
+        return static_cast<T*>(
+            (mp_arena) ? mp_arena->allocate(size) : ::operator new(size)
+        );
+    }
+
+    inline void
+    deallocate(T *p_memory, std::size_t count) noexcept
+    {
+        if(mp_arena)
+            mp_arena->deallocate(p_memory, count * sizeof(T));
+        else
+            ::operator delete(p_memory);
+    }
+
+    inline Arena*
+    get_arena() const noexcept
+    {
+        return mp_arena;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    Arena *mp_arena;
+
+}; // class ArenaAllocator
+
+template <typename T, typename U>
+inline bool
+operator==(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return lhs.get_arena() == rhs.get_arena();
+}
+
+template <typename T, typename U>
+inline bool
+operator!=(const ArenaAllocator<T> &lhs, const ArenaAllocator<U> &rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+NS_CORE2048_END
@@ -0,0 +1,197 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BatchSimulator.h                                              //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <functional>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "BitBoard.h"
+#include "GameCore.h"
+#include "IValuesGenerator.h"
+#include "ThreadPool.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Plays lots of headless 4x4 games with a fixed policy.
+/// @detail
+///   Games are kept in structure of arrays form (boards, random states,
+///   max exponents and moves counts) and advanced in lockstep, a batch of
+///   games at a time. Each game has its own random state, seeded from the
+///   run seed and the game index, so the results of a run are the same
+///   with or without a ThreadPool.                                       \n
+///   Games end when the policy has no valid move left, like a GameCore
+///   they keep going after the victory (a 2048 block), that is counted
+///   on the Stats. The BitBoard doesn't merge two 32768 blocks, so those
+///   games end a bit earlier than on a GameCore.                       \n
+///   The values chances are read from the IValuesGenerator once, when
+///   the BatchSimulator is constructed, so runs don't touch it.
+/// @see BitBoard, ThreadPool.
+class BatchSimulator
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef GameCore::Direction Direction;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The way that the games pick their moves.
+    enum class Policy
+    {
+        Random,   ///< Any valid move.
+        Greedy,   ///< The valid move that leaves more empty cells.
+        Corner,   ///< The first valid of Left, Up, Right, Down.
+        Callback, ///< The move returned by the PolicyCallback.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief Picks the move of a board.
+    /// @detail
+    ///    It's called by all threads of the ThreadPool at the same time.
+    ///    Returning Direction::None or an invalid move ends the game.
+    typedef std::function<Direction (const BitBoard &board)> PolicyCallback;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many games are advanced in lockstep by a task.
+    static constexpr u32 k_batch_size = 1024;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Results of a run.
+    /// @detail
+    ///    The per game vectors are indexed by the game index.
+    ///    Games are played until the defeat, so moves_counts are the
+    ///    moves until it and victories_count are the games that made
+    ///    a 2048 block on the way.
+    struct Stats
+    {
+        u32 games_count;
+        u32 victories_count;
+        u64 moves_count;
+
+        std::vector<u32> scores;       ///< Sum of the values of the board.
+        std::vector<u32> moves_counts; ///< Moves until the end of game.
+
+        /// How many games ended with each max exponent.
+        u32 max_exponents_histogram[BitBoard::k_max_exponent + 1];
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs the BatchSimulator.
+    /// @param p_values_generator
+    ///    The generator of the games values, its max value is changed
+    ///    to read the chances of each max value up to the one of
+    ///    BitBoard::k_max_exponent and then set back to the one it had.
+    ///    Generators that don't tell theirs max value are left with 2,
+    ///    the one of a new game.
+    /// @see IValuesGenerator::get_max_value().
+    explicit BatchSimulator(IValuesGenerator *p_values_generator) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sets one of the built in policies.
+    /// @note Policy::Callback needs set_policy_callback() instead.
+    void set_policy(Policy policy) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the policy to Policy::Callback with the given callback.
+    void set_policy_callback(const PolicyCallback &callback) noexcept;
+
+    inline Policy
+    get_policy() const noexcept
+    {
+        return m_policy;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the threads that the batches are spread across.
+    /// @param p_pool
+    ///    The pool, nullptr makes the games run in the calling thread.
+    ///    It isn't owned by the BatchSimulator.
+    inline void
+    set_thread_pool(ThreadPool *p_pool) noexcept
+    {
+        mp_pool = p_pool;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Plays the games until all of them end.
+    /// @param games_count - How many games will be played.
+    /// @param seed - The seed of the first game, the others derive from it.
+    Stats run(u32 games_count, u64 seed) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void run_batch(
+        u64    seed,
+        u32    first_game,
+        u32    games_count,
+        Stats &stats,
+        u32   *p_max_exponents_histogram) const noexcept;
+
+    bool pick_move(
+        const BitBoard &board,
+        u64            &random,
+        BitBoard       *p_moved) const noexcept;
+
+    u32 generate_block(
+        BitBoard &board,
+        u32       max_exponent,
+        u64      &random) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    ThreadPool     *mp_pool;
+    Policy          m_policy;
+    PolicyCallback  m_policy_callback;
+
+    // Cumulative chances of the exponents that might be generated,
+    // one list for each max exponent of the board.
+    std::vector<std::pair<u32, f32>>
+        m_exponents_chances[BitBoard::k_max_exponent + 1];
+
+}; // class BatchSimulator
+
+NS_CORE2048_END
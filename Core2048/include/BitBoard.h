@@ -0,0 +1,268 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitBoard.h                                                    //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <string>
+// AmazingCow Libs
+#include "acow/math_goodies.h"
+#include "CoreAssert/CoreAssert.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "GameCore.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A 4x4 board packed in a single 64 bits word.
+/// @detail
+///   Each cell is stored as a 4 bits log2 exponent of its value, so an
+///   empty cell is 0, a block of value 2 is 1, a block of value 4 is 2,
+///   and so on up to 32768 (exponent 15).                                  \n
+///   Cells are stored in row major order, the cell (y, x) lives in the
+///   nibble (y * 4 + x), this way every row is a single u16 and the whole
+///   board can be copied, compared and hashed as an integer.               \n
+///   Rows are moved with a LineTable lookup each. Blocks of value 32768
+///   do not merge since the result wouldn't fit in the nibble.
+/// @see BitBoardGameCore.
+class BitBoard
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The width and height of the board.
+    static constexpr u32 k_size = 4;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The biggest exponent that fits in a cell.
+    static constexpr u32 k_max_exponent = 15;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a BitBoard from the packed cells.
+    /// @param cells - The packed cells, default is an empty board.
+    constexpr inline explicit
+    BitBoard(u64 cells = 0) noexcept
+        : m_cells(cells)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Operators                                                              //
+    //------------------------------------------------------------------------//
+public:
+    constexpr inline bool
+    operator==(const BitBoard &rhs) const noexcept
+    {
+        return m_cells == rhs.m_cells;
+    }
+
+    constexpr inline bool
+    operator!=(const BitBoard &rhs) const noexcept
+    {
+        return m_cells != rhs.m_cells;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the packed cells.
+    constexpr inline u64
+    get_cells() const noexcept
+    {
+        return m_cells;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the row at given index packed in a u16.
+    constexpr inline u16
+    get_row(u32 y) const noexcept
+    {
+        return u16((m_cells >> (y * 16)) & 0xFFFF);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the exponent of the cell at given row major index.
+    /// @returns The exponent of the cell, 0 means an empty cell.
+    /// @see get_exponent_at().
+    constexpr inline u32
+    get_exponent_at_index(u32 index) const noexcept
+    {
+        return u32((m_cells >> (index * 4)) & 0xF);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the exponent of the cell at given coord.
+    /// @returns The exponent of the cell, 0 means an empty cell.
+    /// @see get_value_at(), set_exponent_at().
+    inline u32
+    get_exponent_at(const acow::math::Coord &coord) const noexcept
+    {
+        return u32((m_cells >> nibble_shift(coord)) & 0xF);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the value of the cell at given coord.
+    /// @returns The value of the cell, 0 means an empty cell.
+    /// @see get_exponent_at().
+    inline u32
+    get_value_at(const acow::math::Coord &coord) const noexcept
+    {
+        return exponent_to_value(get_exponent_at(coord));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the exponent of the cell at given coord.
+    /// @see get_exponent_at().
+    inline void
+    set_exponent_at(const acow::math::Coord &coord, u32 exponent) noexcept
+    {
+        COREASSERT_ASSERT(
+            exponent <= k_max_exponent,
+            "exponent(%d) must be <= %d",
+            exponent,
+            k_max_exponent
+        );
+
+        auto shift = nibble_shift(coord);
+        m_cells = (m_cells & ~(u64(0xF) << shift)) | (u64(exponent) << shift);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Counts how many cells are empty.
+    u32 count_empty() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the biggest exponent on the board.
+    u32 get_max_exponent() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the summation of the values of all blocks.
+    u32 get_values_sum() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the board that results of moving towards direction.
+    /// @returns
+    ///    The resulting board, if the move isn't possible the
+    ///    returned board is equal to this one.
+    /// @see Direction.
+    BitBoard move(GameCore::Direction direction) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the board with rows and columns swapped.
+    BitBoard transpose() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    ///@brief
+    ///  Just for debug purposes... get a nice formated representation of board.
+    std::string ascii() const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Packs the board of a 4x4 GameCore.
+    /// @note The game must be 4x4 and its blocks must fit in the cells.
+    static BitBoard from_game_core(const GameCore &core) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Merges and moves a packed row towards the nibble 0.
+    /// @see LineTable.
+    static u16 move_row_left(u16 row) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reverses the order of the cells of a packed row.
+    static constexpr inline u16
+    reverse_row(u16 row) noexcept
+    {
+        return u16(
+            ((row >> 12) & 0x000F) | ((row >>  4) & 0x00F0) |
+            ((row <<  4) & 0x0F00) | ((row << 12) & 0xF000)
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Converts a block value to a cell exponent.
+    /// @note Value must be 0 or a power of two up to 32768.
+    static inline u32
+    value_to_exponent(u32 value) noexcept
+    {
+        COREASSERT_ASSERT(
+            (value & (value - 1)) == 0 && value <= (1u << k_max_exponent),
+            "value(%d) must be a power of 2 up to %d",
+            value,
+            (1u << k_max_exponent)
+        );
+
+        return (value == 0) ? 0 : u32(__builtin_ctz(value));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Converts a cell exponent to a block value.
+    static constexpr inline u32
+    exponent_to_value(u32 exponent) noexcept
+    {
+        return (exponent == 0) ? 0 : (1u << exponent);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    static inline u32
+    nibble_shift(const acow::math::Coord &coord) noexcept
+    {
+        COREASSERT_ASSERT(
+            (coord.y >= 0 && coord.y < int(k_size) &&
+             coord.x >= 0 && coord.x < int(k_size)),
+            "Coord (%d,%d) is not valid",
+            coord.y,
+            coord.x
+        );
+
+        return u32(coord.y * k_size + coord.x) * 4;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u64 m_cells;
+
+}; // class BitBoard
+
+NS_CORE2048_END
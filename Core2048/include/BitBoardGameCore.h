@@ -0,0 +1,203 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitBoardGameCore.h                                            //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <string>
+// AmazingCow Libs
+#include "acow/math_goodies.h"
+#include "CoreGame/CoreGame.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "BitBoard.h"
+#include "GameCore.h"
+#include "IValuesGenerator.h"
+#include "Random.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   A 4x4 2048 Game Core that keeps the whole board in a BitBoard.
+/// @detail
+///   It has the same rules and the same interface of GameCore, but since
+///   there is no Block objects to be tracked the make_move() just tells
+///   if the move was performed. It's meant to headless simulations, where
+///   millions of moves are made and nobody is watching the blocks sliding.
+/// @note
+///   Blocks of value 32768 don't merge, they don't fit in the BitBoard.
+///   GameCore merges them, so games that get two of them side by side
+///   aren't the same on both cores.
+/// @see GameCore, BitBoard.
+class BitBoardGameCore
+{
+    //------------------------------------------------------------------------//
+    // Enums / Typedefs / Constants                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef GameCore::Direction Direction;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Construct a new 4x4 BitBoard 2048 Game Core.
+    /// @param p_values_generator
+    ///    The object that will generate the value for the new block.
+    /// @param seed
+    ///    The seed of the CoreRandom numbers generator.
+    ///    Default is Random::kRandomSeed.
+    BitBoardGameCore(
+        IValuesGenerator *p_values_generator,
+        i32 seed = Random::kRandomSeed) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Destructs the object.
+    inline ~BitBoardGameCore() noexcept = default;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Generates the new game block.
+    /// @returns The coord of the new game block.
+    /// @note The board must have at least one empty cell.
+    /// @see IValuesGenerator.
+    acow::math::Coord generate_next_block() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes a move towards the given direction.
+    /// @returns True if the move was performed, false otherwise.
+    /// @see GameCore::make_move().
+    bool make_move(Direction direction) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Checks if a move / merge is possible for that Direction.
+    /// @see GameCore::is_valid_move().
+    inline bool
+    is_valid_move(Direction direction) const noexcept
+    {
+        return m_board.move(direction) != m_board;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the value of the block at given coord, 0 if empty.
+    inline u32
+    get_value_at(const acow::math::Coord &coord) const noexcept
+    {
+        return m_board.get_value_at(coord);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the current state of game board.
+    constexpr inline const BitBoard&
+    get_board() const noexcept
+    {
+        return m_board;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many moves player did so far.
+    constexpr inline u32
+    get_moves_count() const noexcept
+    {
+        return m_moves_count;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the current game status.
+    constexpr inline CoreGame::Status
+    get_status() const noexcept
+    {
+        return m_status;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the summation of all current blocks.
+    constexpr inline u32
+    get_score() const noexcept
+    {
+        return m_score;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the higher value of the current blocks.
+    constexpr inline u32
+    get_max_value() const noexcept
+    {
+        return m_max_value;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the actual seed that game is using
+    inline i32
+    get_seed() const noexcept
+    {
+        return m_random.getSeed();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if CoreRandom is actually using a random seed.
+    inline bool
+    is_using_random_seed() const noexcept
+    {
+        return m_random.isUsingRandomSeed();
+    }
+
+    ///-------------------------------------------------------------------------
+    ///@brief
+    ///  Just for debug purposes... get a nice formated representation of game.
+    inline std::string
+    ascii() const noexcept
+    {
+        return m_board.ascii();
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void check_status() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    IValuesGenerator *mp_values_generator;
+
+    BitBoard m_board;
+    u32      m_moves_count;
+
+    u32 m_max_value;
+    u32 m_score;
+
+    CoreGame::Status m_status;
+    Random           m_random;
+
+}; // class BitBoardGameCore
+
+NS_CORE2048_END
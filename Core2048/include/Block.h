@@ -19,8 +19,6 @@
 //---------------------------------------------------------------------------~//
 
 #pragma once
-// std
-#include <memory> // shared_ptr
 // AmazingCow Libs
 #include "acow/math_goodies.h"
 // Core2048
@@ -44,15 +42,31 @@ public:
 public:
     ///-------------------------------------------------------------------------
     /// @brief
-    ///   Just to reduce verbosity, so instead of
-    ///   std::shared_ptr<Core2048::Block> pBlock we can type
-    ///   Core2048::Block::SPtr.
-    typedef std::shared_ptr<Block> SPtr;
+    ///   Blocks are plain values stored in a contiguous array owned by
+    ///   the GameCore, a Handle is the index of the Block in that array.
+    /// @see GameCore::get_block().
+    typedef u32 Handle;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The Handle of the empty cells.
+    static constexpr Handle k_invalid_handle = 0xFFFFFFFF;
 
     //------------------------------------------------------------------------//
     // CTOR / DTOR                                                            //
     //------------------------------------------------------------------------//
 public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a Block instance with value 0.
+    inline
+    Block() noexcept
+        : m_coord    ()
+        , m_value    (0)
+        , m_old_coord()
+        , m_old_value(0)
+    {
+        // Empty...
+    }
+
     ///-------------------------------------------------------------------------
     /// @brief Constructs a Block instance.
     /// @param coord - The Coord that block will be "placed".
@@ -103,8 +117,8 @@ public:
     ///-------------------------------------------------------------------------
     /// @brief Gets the previous coord of block.
     /// @returns
-    ///   The previous coord of the block, if there's no
-    ///   previous coord, this will return the current coord.
+    ///   The coord of the block before the last move, if the block
+    ///   didn't move this will return the current coord.
     /// @see get_coord(), get_old_coord(), get_old_value().
     constexpr inline const acow::math::Coord
     get_old_coord() const noexcept
@@ -115,8 +129,8 @@ public:
     ///-------------------------------------------------------------------------
     /// @brief Gets the previous value of block.
     /// @return
-    ///   The previous value of block, if there's no
-    ///   previous value, this will return the current value.
+    ///   The value of block before the last move, if the block
+    ///   didn't merge this will return the current value.
     /// @see get_coord(), get_old_coord(), get_value().
     constexpr inline u32
     get_old_value() const noexcept
@@ -145,6 +159,15 @@ private:
         m_value     = value;
     }
 
+    // Makes the current coord and value the old ones too, so
+    // blocks that didn't change on a move don't report stale changes.
+    inline void
+    reset_old_state() noexcept
+    {
+        m_old_coord = m_coord;
+        m_old_value = m_value;
+    }
+
 
     //------------------------------------------------------------------------//
     // iVars                                                                  //
@@ -0,0 +1,163 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CountedRandom.h                                               //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+#include "CoreRandom/CoreRandom.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief A CoreRandom::Random that counts the numbers drawn from it.
+/// @detail
+///   Every number is drawn with the same call to the CoreRandom::Random,
+///   that is then mapped to the range, so going to the nth number of the
+///   seed is making that call n times. That's how the journal and the
+///   snapshots keep the random of the games: the seed and a counter,
+///   instead of a copy of the whole engine (about 5 KB of mt19937).   \n
+///   It has the same interface of CoreRandom::Random, so it can take its
+///   place as the Core2048::Random.
+/// @see Random.h, CounterRandom, set_counter().
+class CountedRandom
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    // Same of CoreRandom::Random.
+    static constexpr i32 kRandomSeed = -1;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief What gives the generator back, with set_state().
+    struct State
+    {
+        u64  counter;
+        i32  seed;
+        bool using_random;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs the generator of the seed.
+    /// @param seed
+    ///    kRandomSeed picks a random seed, that getSeed() gives back
+    ///    so the run can be reproduced.
+    explicit CountedRandom(i32 seed = kRandomSeed) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // CoreRandom::Random Interface                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts the numbers again with another seed.
+    void reseed(i32 seed) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a number in [0, max], [min, max] for the others.
+    inline i32 next()                 noexcept { return next(0, 0x7FFFFFFF); }
+    inline i32 next(i32 max)          noexcept { return next(0, max);        }
+    inline i32
+    next(i32 min, i32 max) noexcept
+    {
+        return to_range(next_bits(), min, max);
+    }
+
+    inline i32  getSeed          () const noexcept { return m_seed;         }
+    inline bool isUsingRandomSeed() const noexcept { return m_using_random; }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief How many numbers were drawn since the seed.
+    inline u64
+    get_counter() const noexcept
+    {
+        return m_counter;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Goes to the state after counter numbers of the seed.
+    /// @detail
+    ///   Going forward draws the numbers in between, going back starts
+    ///   again from the seed, so it costs as many numbers as the counter.
+    void set_counter(u64 counter) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets / Sets the seed and the counter of the generator.
+    /// @see State.
+    inline State
+    get_state() const noexcept
+    {
+        return State{ m_counter, m_seed, m_using_random };
+    }
+
+    void set_state(const State &state) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    // 31 bits, always with the same call.
+    inline u32
+    next_bits() noexcept
+    {
+        ++m_counter;
+        return u32(m_random.next(0, 0x7FFFFFFF));
+    }
+
+    // Multiply and shift with the high bits, no division.
+    static inline i32
+    to_range(u32 bits, i32 min, i32 max) noexcept
+    {
+        auto range = u64(i64(max) - i64(min) + 1);
+        return i32(i64(min) + i64((u64(bits) * range) >> 31));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    CoreRandom::Random m_random;
+    u64                m_counter;
+    i32                m_seed;
+    bool               m_using_random;
+
+}; // class CountedRandom
+
+NS_CORE2048_END
@@ -0,0 +1,179 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CounterRandom.h                                               //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief A counter based random numbers generator (SplitMix64 style).
+/// @detail
+///   The nth number is the SplitMix64 mix of (key + n * gamma), where the
+///   key comes from the seed and the stream, so there's no state besides
+///   the counter: numbers can be skipped or drawn in batches with fill(),
+///   and split() gives independent generators deterministically, like one
+///   per each game or per each thread.                                   \n
+///   It has the same interface of CoreRandom::Random, so it can take its
+///   place as the Core2048::Random.
+/// @see Random.h, split(), fill().
+class CounterRandom
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    // Same of CoreRandom::Random.
+    static constexpr i32 kRandomSeed = -1;
+
+    ///-------------------------------------------------------------------------
+    /// @brief What gives the generator back, with set_state().
+    /// @detail It's the generator itself, it's only a few dozen bytes.
+    typedef CounterRandom State;
+
+private:
+    static constexpr u64 k_gamma = 0x9E3779B97F4A7C15ULL;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs the generator of the stream of the seed.
+    /// @param seed
+    ///    kRandomSeed picks a random seed, that get_seed() gives back
+    ///    so the run can be reproduced.
+    /// @param stream
+    ///    Only the seed is kept by the games, generators of other
+    ///    streams than 0 can't be replayed, split() them instead.
+    explicit CounterRandom(i32 seed = kRandomSeed, u64 stream = 0) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // CoreRandom::Random Interface                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts the stream again with another seed.
+    void reseed(i32 seed) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a number in [0, max], [min, max] for the others.
+    inline i32 next()                 noexcept { return next(0, 0x7FFFFFFF); }
+    inline i32 next(i32 max)          noexcept { return next(0, max);        }
+    inline i32
+    next(i32 min, i32 max) noexcept
+    {
+        return to_range(next_u64(), min, max);
+    }
+
+    inline i32  getSeed          () const noexcept { return m_seed;         }
+    inline bool isUsingRandomSeed() const noexcept { return m_using_random; }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the next 64 bits number of the stream.
+    inline u64
+    next_u64() noexcept
+    {
+        return mix(m_key + (++m_counter) * k_gamma);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets an independent generator for the stream.
+    /// @detail
+    ///   The split has a seed of its own, derived from the key of this
+    ///   generator and the stream, and it's on the stream 0 of that seed.
+    ///   So CounterRandom(split.getSeed()) gives the same numbers, that
+    ///   is what GameRecord and ReplayVerifier keep of the games.    \n
+    ///   The same (seed, stream) always gives the same split, and splits
+    ///   of splits are generators of their own too.
+    /// @note
+    ///    The seeds have 31 bits. The streams below 2^31 of a generator
+    ///    never share a seed, they're a permutation of them, but splits
+    ///    of different generators might: n of them share one with a
+    ///    chance of about n^2 / 2^32, half of the times at 55k splits.
+    CounterRandom split(u64 stream) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the next count numbers in [min, max].
+    /// @detail
+    ///   Gives the same numbers of count calls to next(min, max), but
+    ///   the numbers don't depend on each other, so the loop is unrolled
+    ///   and vectorized by the compiler.
+    void fill(i32 *p_values, u32 count, i32 min, i32 max) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many numbers were drawn since the seed.
+    inline u64  get_counter() const noexcept   { return m_counter;    }
+    inline void set_counter(u64 counter) noexcept { m_counter = counter; }
+
+    inline u64  get_stream() const noexcept { return m_stream; }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets / Sets the whole state of the generator.
+    /// @see State.
+    inline State get_state() const noexcept            { return *this;  }
+    inline void  set_state(const State &state) noexcept { *this = state; }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    static inline u64
+    mix(u64 z) noexcept
+    {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+    // Multiply and shift with the high bits, no division.
+    static inline i32
+    to_range(u64 bits, i32 min, i32 max) noexcept
+    {
+        auto range = u64(i64(max) - i64(min) + 1);
+        return i32(i64(min) + i64(((bits >> 32) * range) >> 32));
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u64  m_key;
+    u64  m_counter;
+    u64  m_stream;
+    i32  m_seed;
+    bool m_using_random;
+
+}; // class CounterRandom
+
+NS_CORE2048_END
@@ -21,6 +21,7 @@
 #pragma once
 // std
 #include <algorithm>
+#include <memory>
 #include <vector>
 // AmazingCow Libs
 #include "acow/math_goodies.h"
@@ -28,25 +29,138 @@
 #include "CoreAssert/CoreAssert.h"
 // Core2048
 #include "Core2048_Utils.h"
+#include "Arena.h"
 #include "Block.h"
 #include "IValuesGenerator.h"
+#include "Random.h"
 
 
 NS_CORE2048_BEGIN
 
+// Forward declarations.
+class GameRecordWriter;
+
 class GameCore
 {
+    friend class GameRecordWriter;
+
     //------------------------------------------------------------------------//
     // Enums / Typedefs / Constants                                           //
     //------------------------------------------------------------------------//
 private:
-    typedef std::vector<Block::SPtr> Line;
+    // The containers of the game, they take theirs memory of its arena.
+    template <typename T>
+    using Vector = std::vector<T, ArenaAllocator<T>>;
+
+    //--------------------------------------------------------------------------
+    // A line of cells of the board, the cell i is i * stride cells after
+    // the first one, so rows and columns are walked the same way in
+    // both orders.
+    template <typename Handle>
+    struct LineView
+    {
+        Handle *p_first;
+        i32     stride;
+        u32     cells_count;
+
+        inline u32 size() const noexcept { return cells_count; }
+
+        inline Handle&
+        operator[](u32 index) const noexcept
+        {
+            return p_first[i32(index) * stride];
+        }
+    };
+
+    typedef LineView<Block::Handle>       Line;
+    typedef LineView<const Block::Handle> ConstLine;
+
 public:
+    ///-------------------------------------------------------------------------
+    /// @brief A row of the Board.
+    /// @see Board.
+    struct Row
+    {
+        const Block::Handle *p_cells;
+        u32                  cells_count;
+
+        inline const Block::Handle* begin() const noexcept { return p_cells; }
+        inline const Block::Handle* end  () const noexcept
+        {
+            return p_cells + cells_count;
+        }
+
+        inline u32 size() const noexcept { return cells_count; }
+
+        inline Block::Handle
+        operator[](u32 x) const noexcept
+        {
+            return p_cells[x];
+        }
+    };
+
     ///-------------------------------------------------------------------------
     /// @brief
     ///    Just to make the code more "understandable",
     ///    since we want to see it as Board, not a simple vector of lines ;D
-    typedef std::vector<Line> Board;
+    ///    Each cell has the Handle of its block, or Block::k_invalid_handle
+    ///    if it's empty.
+    /// @detail
+    ///    The cells are kept in a single row major buffer of the game,
+    ///    the Board is a read only view of its rows, board[y][x] is the
+    ///    cell of the coord (y, x). It's valid while the game exists.
+    /// @see get_board(), get_block().
+    struct Board
+    {
+        // The iterator keeps the row that it points to.
+        struct Iterator
+        {
+            Row row;
+
+            inline const Row& operator* () const noexcept { return  row; }
+            inline const Row* operator->() const noexcept { return &row; }
+
+            inline Iterator&
+            operator++() noexcept
+            {
+                row.p_cells += row.cells_count;
+                return *this;
+            }
+
+            inline bool
+            operator==(const Iterator &other) const noexcept
+            {
+                return row.p_cells == other.row.p_cells;
+            }
+
+            inline bool
+            operator!=(const Iterator &other) const noexcept
+            {
+                return row.p_cells != other.row.p_cells;
+            }
+        };
+
+        const Block::Handle *p_cells;
+        u32                  width;
+        u32                  height;
+
+        inline Iterator begin() const noexcept
+        {
+            return Iterator{ Row{ p_cells, width } };
+        }
+        inline Iterator end() const noexcept
+        {
+            return Iterator{ Row{ p_cells + width * height, width } };
+        }
+
+        inline u32 size() const noexcept { return height; }
+
+        inline Row
+        operator[](u32 y) const noexcept
+        {
+            return Row{ p_cells + y * width, width };
+        }
+    };
 
     ///-------------------------------------------------------------------------
     /// @brief the Direction that the movement can be.
@@ -55,33 +169,177 @@ public:
         Left, Up, Right, Down, None = -1
     };
 
+    ///-------------------------------------------------------------------------
+    /// @brief How the lines are merged and moved.
+    /// @detail
+    ///    Scan      - The blocks of each line are merged and moved in a
+    ///                single pass, columns are walked in place just like
+    ///                the rows.                                          \n
+    ///    LineTable - Each line is resolved with a single LineTable lookup.
+    ///                It's only used for the directions where the lines
+    ///                have LineTable::k_line_size cells and while the
+    ///                blocks are below 32768, that the table doesn't
+    ///                merge, otherwise Scan is used.                    \n
+    ///    LineKernel - Each line is resolved at once by the LineKernel.
+    ///                 It's only used for the directions where the lines
+    ///                 have up to LineKernel::k_max_line_size cells,
+    ///                 otherwise Scan is used.
+    ///    All engines yield the same boards.
+    /// @see set_move_engine(), LineTable, LineKernel.
+    enum class MoveEngine {
+        Scan, LineTable, LineKernel
+    };
+
 
     //------------------------------------------------------------------------//
     // Inner Types                                                            //
     //------------------------------------------------------------------------//
 public:
+    ///-------------------------------------------------------------------------
+    /// @brief A block that changed on a move.
+    /// @detail
+    ///    from and to are the indexes (y * width + x) of the cells of the
+    ///    block before and after the move, old_value and new_value its
+    ///    values before and after it.
+    /// @see MoveResult.
+    struct MoveEvent
+    {
+        u32 from;
+        u32 to;
+        u32 old_value;
+        u32 new_value;
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief A view of the MoveEvents of a kind.
+    /// @see MoveResult.
+    struct MoveEvents
+    {
+        const MoveEvent *p_events;
+        u32              count;
+
+        inline const MoveEvent* begin() const noexcept { return p_events; }
+        inline const MoveEvent* end  () const noexcept
+        {
+            return p_events + count;
+        }
+
+        inline u32  size () const noexcept { return count;      }
+        inline bool empty() const noexcept { return count == 0; }
+
+        inline const MoveEvent&
+        operator[](u32 index) const noexcept
+        {
+            COREASSERT_ASSERT(
+                index < count,
+                "Event index (%d) is out of range (%d)",
+                index,
+                count
+            );
+
+            return p_events[index];
+        }
+    };
+
     ///-------------------------------------------------------------------------
     ///  @brief
     ///     Object that is returned when a move is performed.
     ///  @detail
-    ///     It contains which blocks were moved, merged and removed.          \n
-    ///     moved_blocks   - The blocks that only moved, i.e not got merged.  \n
-    ///     merged_blocks  - The blocks that get merged when moved.           \n
+    ///     It contains the events of the blocks that were moved, merged
+    ///     and removed.                                                      \n
+    ///     moved_blocks   - The blocks that changed theirs cells.            \n
+    ///     merged_blocks  - The blocks that got theirs values doubled.       \n
     ///     removed_blocks - The blocks that should not be in game anymore
     ///                      because they got merged. So for example if two
     ///                      adjacent blocks with the same value are merged,
-    ///                      one of them will be on the merged_blocks vector
-    ///                      and the other on this vector.
-    ///  @see make_move().
+    ///                      one of them will be on the merged_blocks
+    ///                      and the other on this one, on its own cell.
+    ///     Blocks that moved and merged are on both.                        \n
+    ///     The events are kept in a buffer of the game sized to its cells,
+    ///     so moves never allocate and MoveResult is trivially copyable.
+    ///     The events are valid until the next move of the game.
+    ///  @see make_move(), MoveEvent.
     struct MoveResult
     {
-        std::vector<Block::SPtr> moved_blocks;
-        std::vector<Block::SPtr> merged_blocks;
-        std::vector<Block::SPtr> removed_blocks;
+        MoveEvents moved_blocks;
+        MoveEvents merged_blocks;
+        MoveEvents removed_blocks;
 
         bool move_valid;
     };
 
+    ///-------------------------------------------------------------------------
+    /// @brief The whole state of a game, to be restored later.
+    /// @detail
+    ///    Boards of up to 16 cells with values up to 32768 are kept inline
+    ///    as nibbles of exponents, so their snapshots don't touch the heap.
+    ///    Bigger boards keep theirs exponents in a buffer that is never
+    ///    changed, so copies of a snapshot share it.
+    /// @note
+    ///    The random is kept as its Random::State, not as a copy of it:
+    ///    the seed and the counter of the CountedRandom (16 bytes), or
+    ///    the whole CounterRandom (32 bytes). So a 4x4 snapshot is a few
+    ///    dozen bytes with either backend. The CountedRandom is brought
+    ///    back by drawing its numbers again from the seed, so restore()
+    ///    costs as many draws as the game made; fork() copies the random
+    ///    instead.
+    /// @see snapshot(), restore(), fork(), Random.
+    struct Snapshot
+    {
+        u32 width;
+        u32 height;
+
+        u64                                    small_cells;
+        std::shared_ptr<const std::vector<u8>> p_cells;
+
+        int              moves_count;
+        int              max_value;
+        int              score;
+        u64              hash;
+        CoreGame::Status status;
+        Random::State    random;
+    };
+
+private:
+    ///-------------------------------------------------------------------------
+    /// @brief The changes of a turn (a move and its generated blocks).
+    /// @detail
+    ///    Both the cells and the rest of the state hold the "other" side
+    ///    of the turn: the state before it while it's done and the state
+    ///    after it while it's undone. Applying an entry swaps them with
+    ///    the game, so undo and redo are the same operation.
+    ///    Each cell is (index << 8 | exponent), 0 is an empty cell.
+    ///    The random is kept as how many numbers were drawn of it.
+    struct JournalEntry
+    {
+        Vector<u32> cells;
+
+        int              moves_count;
+        int              max_value;
+        int              score;
+        u64              hash;
+        CoreGame::Status status;
+        u64              random_counter;
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The writer that records the game.
+    /// @detail
+    ///    Copies of a recorded game aren't recorded, only the game that
+    ///    the writer began with writes on the record.
+    struct RecordWriter
+    {
+        RecordWriter() noexcept : p_writer(nullptr) {}
+        RecordWriter(const RecordWriter &) noexcept : p_writer(nullptr) {}
+
+        RecordWriter& operator=(const RecordWriter &) noexcept
+        {
+            return *this;
+        }
+
+        GameRecordWriter *p_writer;
+    };
+
 
     //------------------------------------------------------------------------//
     // CTOR / DTOR                                                            //
@@ -96,16 +354,36 @@ public:
     /// @param height
     ///    The height of the game board.
     /// @param seed
-    ///    The seed of the CoreRandom numbers generator.
-    ///    Default is CoreRandom::Random::kRandomSeed.
+    ///    The seed of the random numbers generator.
+    ///    Default is Random::kRandomSeed.
+    /// @param p_arena
+    ///    Where the board, the blocks and the journal of the game take
+    ///    theirs memory from, nullptr takes it from the heap.
+    ///    It must outlive the game and its copies, that use it too.
     /// @note
     ///    There is no valid check on the given arguments, is user
     ///    responsibility give meaningful values.
+    /// @see Random, Arena.
+    GameCore(
+        IValuesGenerator *p_values_generator,
+        u32 width,
+        u32 height,
+        i32 seed = Random::kRandomSeed,
+        Arena *p_arena = nullptr) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Construct a new 2048 Game Core that draws from the random.
+    /// @detail
+    ///    Lets the games use generators that were split for them,
+    ///    like with CounterRandom::split(), get_seed() gives the
+    ///    seed of the random. Games are replayed from that seed, so
+    ///    the random must not have drawn any number yet.
     GameCore(
         IValuesGenerator *p_values_generator,
         u32 width,
         u32 height,
-        i32 seed = CoreRandom::Random::kRandomSeed) noexcept;
+        const Random &random,
+        Arena *p_arena = nullptr) noexcept;
 
     ///-------------------------------------------------------------------------
     /// @brief Destructs the object.
@@ -118,18 +396,56 @@ public:
 public:
     ///-------------------------------------------------------------------------
     /// @brief Generates the new game block.
-    /// @returns A const shared pointer for the new game block.
-    /// @see IValuesGenerator.
-    const Block::SPtr generate_next_block() noexcept;
+    /// @detail
+    ///    The block is put in one of the empty cells, picked with a single
+    ///    random number no matter how full the board is.
+    /// @returns A const reference for the new game block.
+    /// @note The board must have at least one empty cell.
+    /// @see IValuesGenerator, get_empty_cells_count().
+    const Block& generate_next_block() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Generates a block of the value at the coord.
+    /// @detail
+    ///    Nothing is drawn, so recorded games can be replayed without
+    ///    their random and values generators.
+    /// @returns A const reference for the new game block.
+    /// @note The cell of the coord must be empty.
+    /// @see GameRecordReader::replay().
+    const Block&
+    generate_next_block(const acow::math::Coord &coord, u32 value) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many cells of the board are empty.
+    /// @see get_empty_cells().
+    inline u32
+    get_empty_cells_count() const noexcept
+    {
+        return m_empty_cells_count;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the coords of all empty cells of the board.
+    /// @detail
+    ///    The empty cells are kept up to date on every change of the board,
+    ///    so they are read without scanning the board.
+    /// @param p_coords
+    ///    Where the coords are written, in the board order (rows first).
+    ///    Its previous contents are discarded.
+    /// @see get_empty_cells_count().
+    void get_empty_cells(std::vector<acow::math::Coord> *p_coords)
+        const noexcept;
 
     ///-------------------------------------------------------------------------
     /// @brief Gets a block at given coord.
-    /// @returns A const shared pointer for the block at coord.
+    /// @returns
+    ///    A const pointer for the block at coord, nullptr if the
+    ///    cell is empty. The pointer is valid while the game exists.
     /// @note
     ///    There is no valid check on the given arguments, is user
     ///    responsibility give meaningful values.
-    /// @see get_board(), is_valid_coord().
-    inline const Block::SPtr
+    /// @see get_board(), get_block(), is_valid_coord().
+    inline const Block*
     get_block_at(const acow::math::Coord &coord) const noexcept
     {
         COREASSERT_ASSERT(
@@ -139,17 +455,53 @@ public:
             coord.x
         );
 
-        return m_board[coord.y][coord.x];
+        auto handle = m_cells[get_cell_index(coord)];
+        return (handle != Block::k_invalid_handle) ? &m_blocks[handle]
+                                                   : nullptr;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the block of the given handle.
+    /// @returns A const reference for the block.
+    /// @see get_board(), get_block_at(), MoveResult.
+    inline const Block&
+    get_block(Block::Handle handle) const noexcept
+    {
+        COREASSERT_ASSERT(
+            handle < m_blocks.size(),
+            "Handle (%d) is not valid",
+            handle
+        );
+
+        return m_blocks[handle];
     }
 
     ///-------------------------------------------------------------------------
     /// @brief Gets the current state of game board.
-    /// @returns A const reference of the game board.
+    /// @returns A read only view of the game board.
     /// @see get_block_at(), Board.
-    constexpr inline const Board&
+    inline Board
     get_board() const noexcept
     {
-        return m_board;
+        return Board{ m_cells.data(), m_width, m_height };
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the width of the game board.
+    /// @see get_height(), get_board().
+    constexpr inline u32
+    get_width() const noexcept
+    {
+        return m_width;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the height of the game board.
+    /// @see get_width(), get_board().
+    constexpr inline u32
+    get_height() const noexcept
+    {
+        return m_height;
     }
 
     ///-------------------------------------------------------------------------
@@ -172,6 +524,122 @@ public:
     ///    Direction, MoveResult, get_moves_count, get_status(), is_valid_move()
     const MoveResult& make_move(Direction direction) noexcept;
 
+    ///-------------------------------------------------------------------------
+    /// @brief Takes the state of the game.
+    /// @see Snapshot, restore().
+    Snapshot snapshot() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Brings the game back to the state of the snapshot.
+    /// @detail
+    ///    Only the cells that differ are changed and the game storage is
+    ///    reused, so it doesn't allocate. The journal history is dropped,
+    ///    the values generator is kept.
+    /// @note The snapshot must be of a game of the same size.
+    /// @see snapshot(), fork().
+    void restore(const Snapshot &snapshot) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the other game an independent copy of this one.
+    /// @detail
+    ///    Same as p_game->restore(snapshot()), without the snapshot,
+    ///    so forking into the same games over and over, like searches do,
+    ///    doesn't allocate. The move engine is copied too.
+    /// @note The other game must be of the same size.
+    /// @see snapshot(), restore().
+    void fork(GameCore *p_game) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets how many turns can be undone, 0 disables the journal.
+    /// @detail
+    ///    Each valid make_move() and the blocks generated after it are
+    ///    a turn. The journal keeps only the cells that the turn changed
+    ///    and the score, hash, status and random state of the game, so
+    ///    undo() and redo() cost as much as the turn changed, not the
+    ///    board. When it's full the oldest turns are dropped.        \n
+    ///    The history is cleared whenever the capacity is set.
+    /// @note
+    ///    The random of each turn is its counter, 8 bytes with both
+    ///    backends. The CountedRandom (the default) can't go back, so
+    ///    the journal keeps a single copy of it from before its oldest
+    ///    turn and undo() draws again the numbers of the turns after it.
+    /// @see undo(), redo(), Random.
+    void set_journal_capacity(u32 turns_count) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many turns can be undone.
+    inline u32
+    get_journal_capacity() const noexcept
+    {
+        return m_journal_capacity;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Goes back to the state before the last turn.
+    /// @returns false if there's no turn to undo.
+    /// @note The MoveResult is cleared and the blocks handles change.
+    /// @see redo(), set_journal_capacity().
+    bool undo() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Does again the last undone turn.
+    /// @detail
+    ///    The turn is done exactly as before, including its generated
+    ///    blocks. Making a move after an undo() drops the undone turns.
+    /// @returns false if there's no turn to redo.
+    /// @see undo(), set_journal_capacity().
+    bool redo() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if there's a turn to undo / to redo.
+    inline bool
+    can_undo() const noexcept
+    {
+        return m_journal_position != 0;
+    }
+
+    inline bool
+    can_redo() const noexcept
+    {
+        return m_journal_position != m_journal_size;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the arena of the game memory, nullptr if it's the heap.
+    /// @see GameCore::GameCore(), Arena.
+    inline Arena*
+    get_arena() const noexcept
+    {
+        return m_blocks.get_allocator().get_arena();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the writer that records the game, nullptr if none.
+    /// @see GameRecordWriter::begin().
+    inline GameRecordWriter*
+    get_record_writer() const noexcept
+    {
+        return m_record_writer.p_writer;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Selects how the moves will be performed.
+    /// @see MoveEngine, get_move_engine().
+    inline void
+    set_move_engine(MoveEngine move_engine) noexcept
+    {
+        m_move_engine = move_engine;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how the moves are performed.
+    /// @see MoveEngine, set_move_engine().
+    constexpr inline MoveEngine
+    get_move_engine() const noexcept
+    {
+        return m_move_engine;
+    }
+
     ///-------------------------------------------------------------------------
     /// @brief Gets how many moves player did so far.
     /// @returns The count of moves that player did.
@@ -200,8 +668,8 @@ public:
     constexpr inline bool
     is_valid_coord(const acow::math::Coord &coord) const noexcept
     {
-        return coord.y >= 0 && coord.y < m_board.size   ()
-            && coord.x >= 0 && coord.x < m_board[0].size();
+        return coord.y >= 0 && u32(coord.y) < m_height
+            && coord.x >= 0 && u32(coord.x) < m_width;
     }
 
 
@@ -238,6 +706,18 @@ public:
     }
 
 
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the Zobrist hash of the current board.
+    /// @note
+    ///    It's updated with the changes of each move and each generated
+    ///    block, never by hashing the whole board again.
+    /// @see Zobrist.
+    constexpr inline u64
+    get_hash() const noexcept
+    {
+        return m_hash;
+    }
+
     ///-------------------------------------------------------------------------
     /// @brief Gets the actual seed that game is using
     inline i32
@@ -260,44 +740,227 @@ public:
     std::string ascii() const noexcept;
 
 
+    //------------------------------------------------------------------------//
+    // Protected Methods                                                      //
+    //------------------------------------------------------------------------//
+protected:
+    ///-------------------------------------------------------------------------
+    /// @brief The two halves of generate_next_block(), the value is
+    ///   generated in between, after the coord was picked.
+    /// @see StaticGameCore::generate_next_block().
+    acow::math::Coord pick_next_block_coord() noexcept;
+    const Block&      put_next_block(
+        const acow::math::Coord &coord,
+        u32                      value) noexcept;
+
+    inline Random&
+    get_random() noexcept
+    {
+        return m_random;
+    }
+
+    inline void
+    set_values_generator(IValuesGenerator *p_values_generator) noexcept
+    {
+        mp_values_generator = p_values_generator;
+    }
+
+
     //------------------------------------------------------------------------//
     // Private Methods                                                        //
     //------------------------------------------------------------------------//
 private:
-    void merge(const Line &line, const acow::math::Coord &dir_coord) noexcept;
-    bool move (const Line &line, const acow::math::Coord &dir_coord) noexcept;
+    Block* create_block(const acow::math::Coord &coord, u32 value) noexcept;
+    void   clear_move_result ()                                    noexcept;
+    void   fill_move_events  ()                                    noexcept;
+    void   update_move_result()                                    noexcept;
 
-    bool can_merge_line(
-        const Line             &line,
-        const acow::math::Coord &dir_coord) const noexcept;
+    //--------------------------------------------------------------------------
+    // While the move is done the events keep the handles of the blocks,
+    // fill_move_events() makes them the actual events once it's done.
+    inline void
+    add_moved_event(const Block *p_block) noexcept
+    {
+        m_move_events[m_moved_count++].from = get_handle(p_block);
+    }
 
-    bool can_move_line(
-        const Line             &line,
-        const acow::math::Coord &dir_coord) const noexcept;
+    inline void
+    add_merged_event(const Block *p_block) noexcept
+    {
+        m_move_events[get_merged_events_first() + m_merged_count++].from =
+            get_handle(p_block);
+    }
 
+    inline void
+    add_removed_event(const Block *p_block) noexcept
+    {
+        m_move_events[get_removed_events_first() + m_removed_count++].from =
+            get_handle(p_block);
+    }
 
-    Block::SPtr find_first_same_value_block(
-        Block::SPtr            p_src_block,
-        const acow::math::Coord &dir_coord) const noexcept;
+    //--------------------------------------------------------------------------
+    // Each block moves once at most and each merge takes two of them,
+    // so the moved events take up to cells and the others up to half.
+    inline u32
+    get_merged_events_first() const noexcept
+    {
+        return get_width() * get_height();
+    }
 
-    acow::math::Coord find_last_empty_coord(
-        Block::SPtr            p_src_block,
-        const acow::math::Coord &dir_coord) const noexcept;
+    inline u32
+    get_removed_events_first() const noexcept
+    {
+        return get_merged_events_first() + get_merged_events_first() / 2;
+    }
 
-    inline bool
-    is_already_merged(Block::SPtr p_block) const noexcept
+    void begin_journal_entry () noexcept;
+    void record_move_cells   () noexcept;
+    void apply_journal_entry (JournalEntry &entry, bool backwards) noexcept;
+    void rewind_random       (u64 counter) noexcept;
+    void swap_cell           (u32 &cell) noexcept;
+
+    u32  set_cell(const acow::math::Coord &coord, u32 exponent) noexcept;
+    void restore_state(
+        int               moves_count,
+        int               max_value,
+        int               score,
+        u64               hash,
+        CoreGame::Status  status) noexcept;
+
+    inline u32
+    get_cell_exponent(const acow::math::Coord &coord) const noexcept
     {
-         return std::find(
-             std::begin(m_move_result.merged_blocks),
-             std::end  (m_move_result.merged_blocks),
-             p_block
-         ) != std::end(m_move_result.merged_blocks);
+        auto handle = m_cells[get_cell_index(coord)];
+        return (handle != Block::k_invalid_handle)
+            ? u32(__builtin_ctz(m_blocks[handle].get_value()))
+            : 0;
     }
 
+    //--------------------------------------------------------------------------
+    // Visits the cells row by row, the same order of theirs indexes.
+    template <typename Function>
     inline void
-    put_block_at(
-        const acow::math::Coord &coord,
-        const Block::SPtr      p_block) noexcept
+    for_each_coord(Function function) const noexcept
+    {
+        auto coord = acow::math::Coord();
+        for(coord.y = 0; coord.y < int(get_height()); ++coord.y)
+            for(coord.x = 0; coord.x < int(get_width()); ++coord.x)
+                function(coord);
+    }
+
+    inline JournalEntry&
+    get_journal_entry(u32 position) noexcept
+    {
+        return m_journal[(m_journal_first + position) % m_journal_capacity];
+    }
+
+    inline Block*
+    get_mutable_block_at(const acow::math::Coord &coord) noexcept
+    {
+        return const_cast<Block*>(get_block_at(coord));
+    }
+
+    inline void
+    release_handle(Block::Handle handle) noexcept
+    {
+        m_free_handles[m_free_handles_count++] = handle;
+    }
+
+    inline Block::Handle
+    get_handle(const Block *p_block) const noexcept
+    {
+        return Block::Handle(p_block - m_blocks.data());
+    }
+
+
+    bool can_use_line_table (Direction direction) const noexcept;
+    bool can_use_line_kernel(Direction direction) const noexcept;
+
+    u32 get_line_size  (Direction direction) const noexcept;
+    u32 get_lines_count(Direction direction) const noexcept;
+
+    //--------------------------------------------------------------------------
+    // The cell 0 of the line is always the one that blocks are moving
+    // towards, so the index of the lines goes across them.
+    template <typename Handle>
+    static inline LineView<Handle>
+    get_line(
+        Handle    *p_cells,
+        u32        width,
+        u32        height,
+        Direction  direction,
+        u32        index) noexcept
+    {
+        auto last = (height -1) * width;
+        switch(direction)
+        {
+            case Direction::Left:
+                return { p_cells + index * width, 1, width };
+            case Direction::Right:
+                return { p_cells + index * width + width -1, -1, width };
+            case Direction::Up:
+                return { p_cells + index, i32(width), height };
+            case Direction::Down:
+                return { p_cells + last + index, -i32(width), height };
+            case Direction::None:
+                break;
+        }
+
+        return { p_cells, 0, 0 };
+    }
+
+    inline Line
+    get_line(Direction direction, u32 index) noexcept
+    {
+        return get_line(m_cells.data(), m_width, m_height, direction, index);
+    }
+
+    inline ConstLine
+    get_line(Direction direction, u32 index) const noexcept
+    {
+        return get_line(m_cells.data(), m_width, m_height, direction, index);
+    }
+
+    inline acow::math::Coord
+    get_cell_coord(const Block::Handle *p_cell) const noexcept
+    {
+        auto index = u32(p_cell - m_cells.data());
+
+        auto coord = acow::math::Coord();
+        coord.y = index / m_width;
+        coord.x = index % m_width;
+
+        return coord;
+    }
+
+    template <typename Handle>
+    u16 pack_line(const LineView<Handle> &line) const noexcept;
+
+    template <typename Handle>
+    void pack_line_bytes(const LineView<Handle> &line, u8 *p_line)
+        const noexcept;
+
+    void apply_line_transition(
+        const Line &line,
+        const u8   *p_targets,
+        u64         moved_mask,
+        u64         merged_mask,
+        u64         removed_mask) noexcept;
+
+    void move_with_line_table         (Direction direction)       noexcept;
+    bool is_valid_move_with_line_table(Direction direction) const noexcept;
+
+    void move_with_line_kernel         (Direction direction)       noexcept;
+    bool is_valid_move_with_line_kernel(Direction direction) const noexcept;
+
+    void move_with_scan         (Direction direction)       noexcept;
+    bool is_valid_move_with_scan(Direction direction) const noexcept;
+
+    void merge_and_move_line(const Line      &line)       noexcept;
+    bool can_change_line    (const ConstLine &line) const noexcept;
+
+    inline void
+    put_block_at(const acow::math::Coord &coord, Block *p_block) noexcept
     {
         COREASSERT_ASSERT(
             is_valid_coord(coord),
@@ -305,18 +968,52 @@ private:
             coord.y, coord.x
         );
 
+        auto &handle = m_cells[get_cell_index(coord)];
+        if(handle == Block::k_invalid_handle)
+            remove_empty_cell(coord);
+
         p_block->set_coord(coord);
-        m_board[coord.y][coord.x] = p_block;
+        handle = get_handle(p_block);
     }
 
     inline void
     reset_block_at(const acow::math::Coord &coord) noexcept
     {
-        m_board[coord.y][coord.x] = nullptr;
+        auto &handle = m_cells[get_cell_index(coord)];
+        if(handle != Block::k_invalid_handle)
+            add_empty_cell(coord);
+
+        handle = Block::k_invalid_handle;
+    }
+
+    inline u32
+    get_cell_index(const acow::math::Coord &coord) const noexcept
+    {
+        return coord.y * get_width() + coord.x;
+    }
+
+    inline void
+    add_empty_cell(const acow::math::Coord &coord) noexcept
+    {
+        auto index = get_cell_index(coord);
+        m_empty_cells[index / 64] |= (u64(1) << (index % 64));
+        ++m_empty_cells_count;
+    }
+
+    inline void
+    remove_empty_cell(const acow::math::Coord &coord) noexcept
+    {
+        auto index = get_cell_index(coord);
+        m_empty_cells[index / 64] &= ~(u64(1) << (index % 64));
+        --m_empty_cells_count;
     }
 
-    void calculate_score_and_max_value() noexcept;
-    void check_status                 () noexcept;
+    acow::math::Coord get_nth_empty_cell(u32 nth) const noexcept;
+
+    void update_max_value(u32 value) noexcept;
+
+    bool has_equal_neighbours() const noexcept;
+    void check_status        ()       noexcept;
 
 
     //------------------------------------------------------------------------//
@@ -325,16 +1022,57 @@ private:
 private:
     IValuesGenerator *mp_values_generator;
 
-    Board m_board;
-    int   m_moves_count;
+    // The free handles are a stack of fixed size, so copies of the game
+    // don't allocate when the handles are released.
+    Vector<Block>         m_blocks;
+    Vector<Block::Handle> m_free_handles;
+    u32                   m_free_handles_count;
+
+    // The handles of the cells, row by row.
+    Vector<Block::Handle> m_cells;
+    u32                   m_width;
+    u32                   m_height;
+    int                   m_moves_count;
+
+    // One bit for each cell, set when the cell is empty, so empty cells
+    // are picked by their order on the board whatever the move engine.
+    Vector<u64> m_empty_cells;
+    u32         m_empty_cells_count;
 
     int m_max_value;
     int m_score;
+    u64 m_hash;
 
     CoreGame::Status   m_status;
-    CoreRandom::Random m_random;
+    Random             m_random;
+
+    MoveEngine m_move_engine;
+
+    // The moved, merged and removed events, one after the other.
+    // The MoveResult points to them and it's updated on every move,
+    // so copies of the game point to theirs own events after a move.
+    Vector<MoveEvent> m_move_events;
+    u32               m_moved_count;
+    u32               m_merged_count;
+    u32               m_removed_count;
+    MoveResult        m_move_result;
+
+    // A ring of m_journal_capacity entries at most, that grows as needed.
+    // The position is how many of the m_journal_size entries are done,
+    // the ones after it are undone. The last entry is open while the
+    // turn might still get generated blocks.
+    Vector<JournalEntry> m_journal;
+    u32                  m_journal_capacity;
+    u32                  m_journal_first;
+    u32                  m_journal_size;
+    u32                  m_journal_position;
+    bool                 m_journal_open;
+
+    // The random before the oldest turn of the ring, undo() draws again
+    // from it instead of from the seed. Empty until there's a turn.
+    Vector<Random> m_journal_random;
 
-    MoveResult m_move_result;
+    RecordWriter m_record_writer;
 
 }; // class GameCore
 NS_CORE2048_END
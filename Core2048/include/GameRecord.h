@@ -0,0 +1,213 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecord.h                                                  //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    The binary format of the recorded games.                                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstddef>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief The binary format of the recorded games.
+/// @detail
+///   A record is a whole game, from its first blocks to its last turn:
+///     Header | initial blocks | Chunk... | end Chunk | Footer
+///   A chunk has up to k_chunk_moves moves packed 2 bits each, followed
+///   by the blocks generated after each of them. The end chunk has no
+///   moves, and the footer has the final state of the game and the
+///   checksum of the whole record.                                       \n
+///   Each block is a varint of its cell index and exponent, with the low
+///   bit telling if another block of the same turn follows, a turn
+///   without blocks is a single 0. The blocks after the initial ones
+///   are kept in one of two ways:
+///     Seed  - Nothing is kept but the seed, the blocks are generated
+///             again by a game of the same seed and values generator.
+///             Every move but the last must be followed by a single
+///             generated block. The same seed gives other blocks with
+///             the other Random, so they're only read by builds with
+///             the Random of the header.
+///     Cells - All the blocks are kept.
+///   Everything is in the native byte order.
+/// @see GameRecordWriter, GameRecordReader, GameRecordArchive.
+class GameRecord
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    // Version of the format, records of other versions are rejected.
+    static constexpr u32 k_version = 2;
+
+    // Moves on a chunk, the writer buffers a chunk at a time.
+    static constexpr u32 k_chunk_moves = 4096;
+
+    // Blocks of the Cells records must fit in a nibble.
+    static constexpr u32 k_max_exponent = 15;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How the generated blocks are kept.
+    enum class Spawns : u32 {
+        Seed, Cells
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The Random the recorded game was played with.
+    /// @see Random.
+    enum class Randoms : u32 {
+        Counted, Counter
+    };
+
+    // The Random of the games of this build.
+#if defined(CORE2048_COUNTER_RANDOM)
+    static constexpr Randoms k_random = Randoms::Counter;
+#else
+    static constexpr Randoms k_random = Randoms::Counted;
+#endif
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    struct Header
+    {
+        char    magic[8];
+        u32     version;
+        Spawns  spawns;
+        Randoms random;
+        u32     width;
+        u32     height;
+        i64     seed;
+        u64     game_id;
+        u32     values_checksum;     // ValuesTable::get_checksum(), or 0.
+        u32     initial_blocks_size; // Bytes of the initial blocks.
+    };
+
+    struct Chunk
+    {
+        u32 moves_count;
+        u32 blocks_size;
+    };
+
+    struct Footer
+    {
+        u32 moves_count;
+        u32 blocks_count; // Generated after the first move.
+        u32 score;
+        u32 max_value;
+        u64 hash;
+        u32 status;
+        u32 checksum;     // Of everything before it.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief A block generated on the recorded game.
+    struct Block
+    {
+        u32 cell_index;
+        u32 value;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Helpers                                                                //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The magic number at the start of every record.
+    static const char* get_magic() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Continues the FNV-1a checksum with the bytes.
+    static inline u32
+    update_checksum(u32 checksum, const void *p_data, size_t size) noexcept
+    {
+        auto p_bytes = static_cast<const u8*>(p_data);
+        for(auto i = size_t(0); i < size; ++i)
+        {
+            checksum ^= p_bytes[i];
+            checksum *= 16777619u;
+        }
+
+        return checksum;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief The FNV-1a checksum of no bytes.
+    static constexpr inline u32
+    get_empty_checksum() noexcept
+    {
+        return 2166136261u;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the value as LEB128 varint.
+    /// @returns The count of bytes written, at most 10.
+    static inline u32
+    write_varint(u64 value, u8 *p_bytes) noexcept
+    {
+        auto count = 0u;
+        while(value >= 0x80)
+        {
+            p_bytes[count++] = u8(value | 0x80);
+            value >>= 7;
+        }
+        p_bytes[count++] = u8(value);
+
+        return count;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads a LEB128 varint of the bytes.
+    /// @returns The count of bytes read, 0 if it doesn't end on them.
+    static inline u32
+    read_varint(const u8 *p_bytes, size_t size, u64 *p_value) noexcept
+    {
+        auto value = u64(0);
+        for(auto i = 0u; i < size && i < 10; ++i)
+        {
+            value |= u64(p_bytes[i] & 0x7F) << (i * 7);
+            if((p_bytes[i] & 0x80) == 0)
+            {
+                *p_value = value;
+                return i + 1;
+            }
+        }
+
+        return 0;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the bytes of the moves packed on a chunk.
+    static constexpr inline u32
+    get_moves_size(u32 moves_count) noexcept
+    {
+        return (moves_count + 3) / 4;
+    }
+
+}; // class GameRecord
+
+NS_CORE2048_END
@@ -0,0 +1,163 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordArchive.h                                           //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    An append only file of GameRecords with an index.                       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief An append only file of GameRecords with an index.
+/// @detail
+///   The records are appended one after another to the file, and the
+///   offsets of them are appended to the index file (filename.idx),
+///   only once the record is whole. So the records can be found by
+///   theirs game ids and read without going through the others.     \n
+///   The index is rebuilt from the records when it's missing or behind
+///   the file, a record that was cut short is left out of it.
+/// @see GameRecord, GameRecordWriter, GameRecordReader.
+class GameRecordArchive
+{
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    struct IndexEntry
+    {
+        u64 game_id;
+        u64 offset;
+    };
+
+private:
+    struct IndexHeader
+    {
+        char magic[8];
+        u32  version;
+        u32  entry_size;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Opens the archive, creating it if it doesn't exist.
+    /// @see is_open().
+    explicit GameRecordArchive(const std::string &filename) noexcept;
+
+    GameRecordArchive(const GameRecordArchive &) = delete;
+    GameRecordArchive& operator=(const GameRecordArchive &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts appending a record.
+    /// @returns The stream to give to the GameRecordWriter.
+    /// @note Records are appended one at a time.
+    /// @see end_record().
+    std::ostream* begin_record(u64 game_id) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Adds the appended record to the index.
+    /// @returns true if the record and its index entry were written.
+    /// @note The writer must have ended the record.
+    bool end_record() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the stream at the start of the nth record.
+    /// @returns The stream to give to the GameRecordReader.
+    std::istream* seek_record(u32 nth) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Finds the first record of the game id.
+    /// @returns true if found, with its position on p_nth.
+    bool find(u64 game_id, u32 *p_nth) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if both files could be opened.
+    inline bool
+    is_open() const noexcept
+    {
+        return m_out.is_open() && m_in.is_open() && m_index_out.is_open();
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many records are on the index.
+    inline u32
+    get_records_count() const noexcept
+    {
+        return u32(m_index.size());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the index entry of the nth record.
+    inline const IndexEntry&
+    get_entry(u32 nth) const noexcept
+    {
+        return m_index[nth];
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    bool load_index   () noexcept;
+    void scan_records (u64 offset) noexcept;
+    void add_entry    (const IndexEntry &entry) noexcept;
+    void write_index  () noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::string m_filename;
+    std::string m_index_filename;
+
+    std::ofstream m_out;
+    std::ifstream m_in;
+    std::ofstream m_index_out;
+    u64           m_size;
+
+    std::vector<IndexEntry>      m_index;
+    std::unordered_map<u64, u32> m_game_ids;
+
+    // The record being appended.
+    bool m_appending;
+    u64  m_record_game_id;
+
+}; // class GameRecordArchive
+
+NS_CORE2048_END
@@ -0,0 +1,190 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordReader.h                                            //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streams the turns of a GameRecord and replays them.                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <istream>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "GameCore.h"
+#include "GameRecord.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Streams the turns of a GameRecord and replays them.
+/// @detail
+///   The turns are read a chunk at a time, so records of any length
+///   are read with the memory of a chunk.                              \n
+///   Records are untrusted, a broken or tampered record makes the
+///   reader invalid instead of failing an assertion, and so does a Seed
+///   record of a build with the other Random.
+/// @see GameRecord, GameRecordWriter, GameRecordArchive.
+class GameRecordReader
+{
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief A move and the blocks generated after it.
+    /// @detail Seed records have no blocks.
+    struct Turn
+    {
+        GameCore::Direction            direction;
+        std::vector<GameRecord::Block> blocks;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads the header of the record at the stream position.
+    /// @see is_valid().
+    explicit GameRecordReader(std::istream *p_stream) noexcept;
+
+    GameRecordReader(const GameRecordReader &) = delete;
+    GameRecordReader& operator=(const GameRecordReader &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Reads the next turn.
+    /// @returns
+    ///    false after the last turn, when the footer was read, or if
+    ///    the record is broken.
+    /// @see is_complete().
+    bool read_turn(Turn *p_turn) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Plays the rest of the turns on the game.
+    /// @detail
+    ///    Seed records are replayed by a new game of the seed and of the
+    ///    values generator of the recorded game, Cells records by any
+    ///    game of the same size, that has its board replaced by the
+    ///    initial blocks.
+    /// @returns
+    ///    true if the whole record was replayed and the game ended
+    ///    in the state that the footer has.
+    bool replay(GameCore *p_game) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if nothing was wrong with the record so far.
+    inline bool
+    is_valid() const noexcept
+    {
+        return m_valid;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if the footer was read and its checksum matched.
+    inline bool
+    is_complete() const noexcept
+    {
+        return m_complete;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the header of the record.
+    inline const GameRecord::Header&
+    get_header() const noexcept
+    {
+        return m_header;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the footer of the record, once it's complete.
+    inline const GameRecord::Footer&
+    get_footer() const noexcept
+    {
+        return m_footer;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the blocks that the game had before the first move.
+    /// @detail Seed records have no blocks.
+    inline const std::vector<GameRecord::Block>&
+    get_initial_blocks() const noexcept
+    {
+        return m_initial_blocks;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many bytes of the stream were read.
+    inline u64
+    get_size() const noexcept
+    {
+        return m_size;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    bool read_header() noexcept;
+    bool read_chunk () noexcept;
+    bool read_footer() noexcept;
+
+    bool read_blocks(
+        const std::vector<u8>          &bytes,
+        size_t                         *p_offset,
+        std::vector<GameRecord::Block> *p_blocks) noexcept;
+
+    bool read(void *p_data, size_t size) noexcept;
+    bool fail() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::istream *mp_stream;
+
+    GameRecord::Header             m_header;
+    GameRecord::Footer             m_footer;
+    std::vector<GameRecord::Block> m_initial_blocks;
+
+    // The chunk being read.
+    std::vector<u8> m_moves;
+    std::vector<u8> m_blocks;
+    u32             m_chunk_moves_count;
+    u32             m_chunk_move;
+    size_t          m_blocks_offset;
+
+    u32  m_moves_count;
+    u32  m_checksum;
+    u64  m_size;
+    bool m_valid;
+    bool m_complete;
+
+}; // class GameRecordReader
+
+NS_CORE2048_END
@@ -0,0 +1,145 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordWriter.h                                            //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streams the turns of a GameCore as a GameRecord.                        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <ostream>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "GameCore.h"
+#include "GameRecord.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Streams the turns of a GameCore as a GameRecord.
+/// @detail
+///   Once begun the game tells the writer about its moves and generated
+///   blocks, so nothing has to be done on each turn. The moves are
+///   buffered a chunk at a time and written as the chunks fill up.   \n
+///   Seed records are only replayable by a game constructed with the
+///   seed (and the stream of CounterRandom) of the recorded game.
+/// @note
+///   Recorded games can't be undone, redone or restored, and they must
+///   outlive the writer or its end().
+/// @see GameRecord, GameRecordReader, GameRecordArchive.
+class GameRecordWriter
+{
+    friend class GameCore;
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a writer of records on the stream.
+    /// @param p_stream - Where the record goes, a binary stream.
+    /// @param spawns - How the generated blocks are kept.
+    /// @param game_id - Anything that identifies the game.
+    /// @param values_checksum - Of the table of the values generator,
+    ///    ValuesTable::get_checksum(), 0 if none.
+    GameRecordWriter(
+        std::ostream       *p_stream,
+        GameRecord::Spawns  spawns,
+        u64                 game_id         = 0,
+        u32                 values_checksum = 0) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Ends the record if it wasn't.
+    ~GameRecordWriter() noexcept;
+
+    GameRecordWriter(const GameRecordWriter &) = delete;
+    GameRecordWriter& operator=(const GameRecordWriter &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Starts recording the game.
+    /// @detail The blocks on the board are the initial blocks.
+    /// @note The game must have no moves and no other writer.
+    void begin(GameCore *p_game) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the rest of the record and stops recording.
+    /// @returns true if the whole record was written to the stream.
+    bool end() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if a game is being recorded.
+    inline bool
+    is_recording() const noexcept
+    {
+        return mp_game != nullptr;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // GameCore Hooks                                                         //
+    //------------------------------------------------------------------------//
+private:
+    void on_move (GameCore::Direction direction) noexcept;
+    void on_block(u32 cell_index, u32 value) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void write_header() noexcept;
+    void write_block (u32 cell_index, u32 value) noexcept;
+    void end_turn    () noexcept;
+    void flush_chunk () noexcept;
+
+    void write(const void *p_data, size_t size) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::ostream       *mp_stream;
+    GameRecord::Spawns  m_spawns;
+    u64                 m_game_id;
+    u32                 m_values_checksum;
+
+    GameCore *mp_game;
+    u32       m_checksum;
+
+    // The chunk being filled, the initial blocks before the first move.
+    std::vector<u8> m_moves;
+    std::vector<u8> m_blocks;
+    u32             m_chunk_moves_count;
+    size_t          m_last_block_offset;
+
+    u32 m_moves_count;
+    u32 m_blocks_count;
+    u32 m_turn_blocks_count;
+
+}; // class GameRecordWriter
+
+NS_CORE2048_END
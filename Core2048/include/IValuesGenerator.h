@@ -19,16 +19,30 @@
 //---------------------------------------------------------------------------~//
 
 #pragma once
+// std
+#include <utility>
+#include <vector>
 // AmazingCow Libs.
-#include "CoreRandom/CoreRandom.h"
 #include "acow/cpp_goodies.h"
 // Core2048
 #include "Core2048_Utils.h"
+#include "Random.h"
 
 NS_CORE2048_BEGIN
 
 class IValuesGenerator
 {
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Pairs of value and the chance of it be generated,
+    ///   the chances are in [0, 1] range and sum up to 1.
+    typedef std::vector<std::pair<u32, f32>> ValuesChances;
+
+
     //------------------------------------------------------------------------//
     // CTOR / DTOR                                                            //
     //------------------------------------------------------------------------//
@@ -50,15 +64,42 @@ public:
     ///    Implementors might want take a look on the set_max_value() method
     ///    that is called to give a hint of the max value of the current board.
     /// @param rnd_gen
-    ///    The current CoreRandom::Random object that GameCore
+    ///    The current Random object that GameCore
     ///    is using to generate random numbers.
     /// @see set_max_value(), GameCore.
-    virtual u32 generate_value(CoreRandom::Random &rnd_gen) noexcept = 0;
+    virtual u32 generate_value(Random &rnd_gen) noexcept = 0;
 
     ///-------------------------------------------------------------------------
     /// @brief Set the max value on the current board.
     virtual void set_max_value(u32 v) noexcept  = 0;
 
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the max value that was set last.
+    /// @returns
+    ///    0 if it wasn't set yet or if the generator doesn't keep it,
+    ///    which is the default.
+    /// @see set_max_value().
+    virtual u32
+    get_max_value() const noexcept
+    {
+        return 0;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the values that can be generated for the current max value.
+    /// @detail
+    ///    This is what generate_value() is drawing from, searches use it to
+    ///    know the possible blocks that might enter in game.
+    ///    The default is the classic 2 (90%) / 4 (10%) split, so generators
+    ///    that don't override it keep working with the Solver and the
+    ///    BatchSimulator, that then assume that split.
+    /// @see generate_value(), set_max_value(), ValuesChances.
+    virtual ValuesChances
+    get_values_chances() const noexcept
+    {
+        return { {2, 0.9f}, {4, 0.1f} };
+    }
+
 }; // IValuesGenerator
 
 NS_CORE2048_END
@@ -0,0 +1,118 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineKernel.h                                                  //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Moves lines too wide for the LineTable with SIMD instructions.
+/// @detail
+///   A line is an array of k_max_line_size bytes, one log2 exponent per
+///   cell and 0 for the empty ones, with the cells after the line size
+///   set to 0. Lines are always moved towards the cell 0 like LineTable.  \n
+///   The whole line is processed at once: the non empty cells are
+///   compacted, the adjacent equal pairs are found with bit masks and
+///   then merged while the cells are compacted again.                     \n
+///   The best instruction set of the CPU (AVX2, SSE4.1 or none) is
+///   chosen at runtime, all of them yield the same results.
+/// @see LineTable, GameCore::MoveEngine.
+class LineKernel
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The biggest line that the kernel can move.
+    static constexpr u32 k_max_line_size = 64;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The instructions sets that the kernel is implemented with.
+    enum class Isa {
+        Scalar, SSE41, AVX2
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The result of moving a line.
+    /// @detail
+    ///   All the masks and targets are indexed by the cell that the block
+    ///   was before the move, like on LineTable::Transition.              \n
+    ///   line         - The resulting line.                               \n
+    ///   targets      - The cell that the block went to, only set for
+    ///                  the cells that aren't empty.                      \n
+    ///   moved_mask   - Blocks that changed its cell.                     \n
+    ///   merged_mask  - Blocks that got its value doubled.                \n
+    ///   removed_mask - Blocks that got merged into another block and
+    ///                  should not be in game anymore.
+    struct Transition
+    {
+        u8  line   [k_max_line_size];
+        u8  targets[k_max_line_size];
+        u64 moved_mask;
+        u64 merged_mask;
+        u64 removed_mask;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Moves the line towards the cell 0 with the best Isa.
+    /// @param p_line - The k_max_line_size cells of the line.
+    /// @param p_transition - Where the result is written.
+    /// @see get_isa().
+    static void move_line(
+        const u8   *p_line,
+        Transition *p_transition) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Moves the line towards the cell 0 with the given Isa.
+    /// @note The Isa must be supported by the CPU.
+    /// @see is_isa_supported().
+    static void move_line(
+        Isa         isa,
+        const u8   *p_line,
+        Transition *p_transition) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the Isa that move_line() uses, the best one supported.
+    static Isa get_isa() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if the CPU can run the kernel with the Isa.
+    static bool is_isa_supported(Isa isa) noexcept;
+
+}; // class LineKernel
+
+NS_CORE2048_END
@@ -0,0 +1,124 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineTable.h                                                   //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief
+///   Precomputed results of moving every possible line of 4 cells.
+/// @detail
+///   A line is packed in a u16 the same way that BitBoard packs its rows,
+///   4 bits log2 exponent per cell, with the cell 0 at the lowest nibble.
+///   Lines are always moved towards the cell 0, so moving to other
+///   directions is a matter of reading the cells in the reversed order
+///   or reading the columns instead of the rows.                            \n
+///   The table has 65536 entries and it's built the first time
+///   that it's used, so games that don't use it don't pay for it.
+/// @see BitBoard, GameCore::MoveEngine.
+class LineTable
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief How many cells a line must have to use the table.
+    static constexpr u32 k_line_size = 4;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The biggest exponent that fits in a cell.
+    /// @note Cells with this exponent do not merge.
+    static constexpr u32 k_max_exponent = 15;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many entries the table has.
+    static constexpr u32 k_entries_count = 65536;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief The result of moving a line.
+    /// @detail
+    ///   All the masks and targets are indexed by the cell that the block
+    ///   was before the move.                                              \n
+    ///   line         - The resulting packed line.                         \n
+    ///   score        - The summation of the values created by merges.     \n
+    ///   moved_mask   - Blocks that changed its cell.                      \n
+    ///   merged_mask  - Blocks that got its value doubled.                 \n
+    ///   removed_mask - Blocks that got merged into another block and
+    ///                  should not be in game anymore.                     \n
+    ///   targets      - 2 bits per cell, the cell that the block went to.
+    struct Transition
+    {
+        u32 score;
+        u16 line;
+        u8  moved_mask;
+        u8  merged_mask;
+        u8  removed_mask;
+        u8  targets;
+
+        ///---------------------------------------------------------------------
+        /// @brief Gets the cell that block at index went to.
+        constexpr inline u32
+        get_target(u32 index) const noexcept
+        {
+            return (targets >> (index * 2)) & 0x3;
+        }
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the result of moving the packed line towards the cell 0.
+    /// @note The table is built in the first call.
+    static inline const Transition&
+    get_transition(u16 line) noexcept
+    {
+        return get_table()[line];
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Computes the result of moving the line without the table.
+    /// @note This is what is used to build the table.
+    static Transition compute_transition(u16 line) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    static const Transition* get_table() noexcept;
+
+}; // class LineTable
+
+NS_CORE2048_END
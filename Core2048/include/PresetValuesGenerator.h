@@ -20,53 +20,80 @@
 
 #pragma once
 // std
+#include <memory>
 #include <string>
-#include <map>
-#include <utility>
-#include <vector>
 // AmazingCow Libs
 #include "acow/cpp_goodies.h"
 // Core2048
 #include "Core2048_Utils.h"
 #include "IValuesGenerator.h"
+#include "ValuesTable.h"
 
 
 NS_CORE2048_BEGIN
 
+///-----------------------------------------------------------------------------
+/// @brief Generates the values of the blocks from a ValuesTable.
+/// @detail
+///   generate_value() is O(1) and takes a single random number no matter
+///   how many values the row of the max value has.                       \n
+///   Generators can share a table, so constructing them from a table
+///   or from a binary file doesn't parse anything.                       \n
+///   Max values without a row of their own draw from the row of the
+///   greatest max value below them, so the last row of the table is
+///   used for all the max values past it.
+/// @see ValuesTable.
 class PresetValuesGenerator
     : public IValuesGenerator
 {
-    //------------------------------------------------------------------------//
-    // Enums / Constants / Typedef                                            //
-    //------------------------------------------------------------------------//
-private:
-    typedef std::map<u32, std::vector<std::pair<u32,u32>>> ValuesMatrix;
-
-
     //------------------------------------------------------------------------//
     // CTOR                                                                   //
     //------------------------------------------------------------------------//
 public:
     ///-------------------------------------------------------------------------
     /// @brief Constructs a ValueGenerator based on the specs found on file.
+    /// @detail The file might be either a text or a binary values table.
     /// @note An example of such file is found in resouces/values.txt
+    /// @see ValuesTable::load().
     PresetValuesGenerator(const std::string &filename) noexcept;
 
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a ValueGenerator that draws from the table.
+    PresetValuesGenerator(std::shared_ptr<const ValuesTable> p_table) noexcept;
+
 
     //------------------------------------------------------------------------//
     // IValuesGenerator Interface                                             //
     //------------------------------------------------------------------------//
 public:
-    virtual u32  generate_value(CoreRandom::Random &rnd_gen) noexcept override;
+    virtual u32  generate_value(Random &rnd_gen) noexcept override;
     virtual void set_max_value(u32 value) noexcept override;
+    virtual u32  get_max_value() const noexcept override;
+
+    virtual ValuesChances get_values_chances() const noexcept override;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the table that the values are drawn from.
+    inline const std::shared_ptr<const ValuesTable>&
+    get_values_table() const noexcept
+    {
+        return mp_table;
+    }
 
 
     //------------------------------------------------------------------------//
     // iVars                                                                  //
     //------------------------------------------------------------------------//
 private:
-    u32          m_max_value;
-    ValuesMatrix m_values_matrix;
+    u32                                m_max_value;
+    std::shared_ptr<const ValuesTable> mp_table;
+    const ValuesTable::Row            *mp_row;
+    const ValuesTable::Entry          *mp_entries;
 };
 
 NS_CORE2048_END
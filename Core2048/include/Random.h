@@ -0,0 +1,49 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Random.h                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "CountedRandom.h"
+#include "CounterRandom.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief The random numbers generator of the cores and of the generators.
+/// @detail
+///   It's the CountedRandom, a CoreRandom::Random that counts its numbers,
+///   unless the core is built with CORE2048_COUNTER_RANDOM (the CMake
+///   option of the same name), then it's the CounterRandom.           \n
+///   Both tell how many numbers were drawn with get_counter() and go to
+///   any of them with set_counter(), so the journal of the games keeps
+///   only the counter of each turn. The CounterRandom does it in O(1),
+///   the CountedRandom draws the numbers in between.
+/// @see CountedRandom, CounterRandom, GameCore, IValuesGenerator.
+#if defined(CORE2048_COUNTER_RANDOM)
+    typedef CounterRandom Random;
+#else
+    typedef CountedRandom Random;
+#endif
+
+NS_CORE2048_END
@@ -0,0 +1,223 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ReplayVerifier.h                                              //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Verifies the scores of played games by replaying them.                  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <functional>
+#include <memory>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "Arena.h"
+#include "GameCore.h"
+#include "GameRecordReader.h"
+#include "IValuesGenerator.h"
+#include "ThreadPool.h"
+#include "ValuesTable.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Verifies the scores of played games by replaying them.
+/// @detail
+///   A game is its seed, its moves and the score that it claims. It's
+///   replayed from the seed, with a block generated after each move like
+///   a GameCore is played, and its first illegal move ends the replay. \n
+///   4x4 games are replayed on a BitBoardGameCore, so there are no
+///   blocks nor MoveResults to be kept, other sizes on a GameCore.
+///   BitBoardGameCore doesn't merge blocks of value 32768, so the 4x4
+///   games that made one are replayed again on a GameCore, that gives
+///   their verdict.                                                    \n
+///   Games are verified a batch at a time, each batch with its own values
+///   generator, and the batches are spread across the ThreadPool.
+/// @see GameRecord, BitBoardGameCore, ThreadPool.
+class ReplayVerifier
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the values generator of a batch.
+    /// @detail
+    ///    Generators keep the max value of the game, so each batch has its
+    ///    own. It's called by all threads of the ThreadPool at the same time.
+    ///    Generators can't be deleted through IValuesGenerator, so they're
+    ///    given as shared_ptrs made of the concrete type.
+    typedef std::function<std::shared_ptr<IValuesGenerator> ()>
+        GeneratorFactory;
+
+    ///-------------------------------------------------------------------------
+    /// @brief How many games are verified by a task.
+    static constexpr u32 k_batch_size = 1024;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The outcome of the verification of a game.
+    enum class Verdict : u32
+    {
+        Valid,         ///< All moves are legal and the score is the claimed.
+        IllegalMove,   ///< A move didn't change the board, or it was lost.
+        ScoreMismatch, ///< All moves are legal but the score differs.
+        Malformed,     ///< The game can't be replayed at all.
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief A played game, as it was submitted.
+    struct Game
+    {
+        i32 seed;
+        u32 width;
+        u32 height;
+
+        /// Blocks before the first move, the GameCore generates the first.
+        u32 initial_blocks_count;
+
+        /// Packed 2 bits each, the first on the low bits, like GameRecord.
+        std::vector<u8> moves;
+        u32             moves_count;
+
+        /// Blocks after the first move, moves_count or moves_count - 1
+        /// when the last move has no block.
+        u32 blocks_count;
+
+        u32 claimed_score;
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The verification of a game.
+    struct Result
+    {
+        Verdict verdict;
+        u32     moves_count; ///< Replayed, the illegal one isn't counted.
+        u32     score;       ///< Of the replayed moves.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The counters of verify().
+    struct Counters
+    {
+        u64 games_count;
+        u64 moves_count;  ///< Replayed moves of all games.
+
+        /// How many games got each verdict, indexed by the Verdict.
+        u64 verdicts_counts[4];
+
+        f64 seconds;
+        f64 games_per_second;
+        f64 moves_per_second;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a verifier with the generators of the factory.
+    explicit ReplayVerifier(const GeneratorFactory &factory) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a verifier with PresetValuesGenerators that share
+    ///   the table.
+    explicit ReplayVerifier(std::shared_ptr<const ValuesTable> p_table)
+        noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the threads that the batches are spread across.
+    /// @param p_pool
+    ///    The pool, nullptr makes the games run in the calling thread.
+    ///    It isn't owned by the ReplayVerifier.
+    inline void
+    set_thread_pool(ThreadPool *p_pool) noexcept
+    {
+        mp_pool = p_pool;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Verifies the games.
+    /// @param games - The games to be verified.
+    /// @param p_results - Gets the result of each game, by its index.
+    /// @returns The counters of this call.
+    /// @see get_total_counters().
+    Counters verify(
+        const std::vector<Game> &games,
+        std::vector<Result>     *p_results) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Verifies a single game, on the calling thread.
+    Result verify_game(const Game &game) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the counters of all verify() calls so far.
+    inline const Counters&
+    get_total_counters() const noexcept
+    {
+        return m_total_counters;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Reads the game of a Seed record.
+    /// @returns
+    ///    false if the record isn't a whole Seed record, Cells records
+    ///    are verified by GameRecordReader::replay() instead.
+    static bool read_game(GameRecordReader *p_reader, Game *p_game) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void verify_batch(
+        const Game       *p_games,
+        u32               games_count,
+        Result           *p_results,
+        IValuesGenerator *p_generator) const noexcept;
+
+    Result verify_game(
+        const Game       &game,
+        IValuesGenerator *p_generator,
+        Arena            *p_arena) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    ThreadPool       *mp_pool;
+    GeneratorFactory  m_factory;
+    Counters          m_total_counters;
+
+}; // class ReplayVerifier
+
+NS_CORE2048_END
@@ -0,0 +1,270 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SessionHost.h                                                 //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Hosts the games of many players at once.                                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "Arena.h"
+#include "GameCore.h"
+#include "IValuesGenerator.h"
+#include "ThreadPool.h"
+#include "ValuesTable.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Hosts the games of many players at once, by theirs session ids.
+/// @detail
+///   The sessions are spread across shards by theirs ids, each shard with
+///   its own lock, Arena and values generator, so players of different
+///   shards never wait on each other.                                    \n
+///   A valid move is followed by a new block, like a GameCore is played.\n
+///   Moves can be applied one by one, from any thread, or in batches.
+///   The moves of a batch are grouped by shard and each shard takes its
+///   lock once for all of its moves. With a ThreadPool the shards always
+///   run on the same worker, so theirs games stay in the caches of its
+///   thread. The moves of a session are applied in the order they were
+///   given.
+/// @see GameCore, ThreadPool, Arena.
+class SessionHost
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef u64 SessionId;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Never given by create().
+    static constexpr SessionId k_invalid_session_id = 0;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The shards of the default constructors.
+    static constexpr u32 k_default_shards_count = 64;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the values generator of a shard.
+    /// @detail
+    ///    The games of a shard share its generator, its max value is set
+    ///    to the one of the game before each block is generated.
+    ///    Generators can't be deleted through IValuesGenerator, so they're
+    ///    given as shared_ptrs made of the concrete type.
+    typedef std::function<std::shared_ptr<IValuesGenerator> ()>
+        GeneratorFactory;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief A move of a batch.
+    struct Move
+    {
+        SessionId           session_id;
+        GameCore::Direction direction;
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The game of a session after a move.
+    /// @detail
+    ///    The MoveResult isn't kept, its events are only valid until
+    ///    the next move of the game.
+    struct MoveOutcome
+    {
+        bool session_found;
+        bool move_valid;    ///< The board changed and got a new block.
+
+        u32              moves_count;
+        u32              score;
+        u64              hash;
+        CoreGame::Status status;
+    };
+
+private:
+    typedef std::unordered_map<
+        SessionId,
+        GameCore,
+        std::hash<SessionId>,
+        std::equal_to<SessionId>,
+        ArenaAllocator<std::pair<const SessionId, GameCore>>
+    > Sessions;
+
+    // The arena and the generator must outlive the games.
+    struct Shard
+    {
+        std::mutex                        mutex;
+        Arena                             arena;
+        std::shared_ptr<IValuesGenerator> p_generator;
+        Sessions                          sessions;
+
+        explicit Shard(std::shared_ptr<IValuesGenerator> p_values_generator)
+            noexcept;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a host with the generators of the factory.
+    /// @param shards_count
+    ///    How many shards the sessions are spread across, more shards
+    ///    than threads keep the threads from waiting on the same lock.
+    explicit SessionHost(
+        const GeneratorFactory &factory,
+        u32 shards_count = k_default_shards_count) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a host with PresetValuesGenerators that share
+    ///   the table.
+    explicit SessionHost(
+        std::shared_ptr<const ValuesTable> p_table,
+        u32 shards_count = k_default_shards_count) noexcept;
+
+    SessionHost(const SessionHost &) = delete;
+    SessionHost& operator=(const SessionHost &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the threads that the batches are run on.
+    /// @param p_pool
+    ///    The pool, nullptr makes the batches run in the calling thread.
+    ///    It isn't owned by the SessionHost.
+    /// @see apply_moves().
+    inline void
+    set_thread_pool(ThreadPool *p_pool) noexcept
+    {
+        mp_pool = p_pool;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Starts a new game.
+    /// @returns The id of its session, it's never reused.
+    /// @see GameCore::GameCore(), close().
+    SessionId create(u32 width, u32 height, i32 seed) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes a move on the game of the session.
+    /// @see GameCore::make_move(), apply_moves().
+    MoveOutcome apply_move(
+        SessionId           session_id,
+        GameCore::Direction direction) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Makes the moves of a batch.
+    /// @param moves - The moves, of any sessions.
+    /// @param p_outcomes - Gets the outcome of each move, by its index.
+    /// @note
+    ///    It waits the ThreadPool, so it must not be called from inside
+    ///    of its tasks.
+    /// @see apply_move(), set_thread_pool().
+    void apply_moves(
+        const std::vector<Move>  &moves,
+        std::vector<MoveOutcome> *p_outcomes) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Takes the state of the game of the session.
+    /// @returns false if there is no such session.
+    /// @see GameCore::snapshot().
+    bool snapshot(SessionId session_id, GameCore::Snapshot *p_snapshot)
+        noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Ends the session, its game is destroyed.
+    /// @returns false if there is no such session.
+    bool close(SessionId session_id) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many sessions are open.
+    inline u32
+    get_sessions_count() const noexcept
+    {
+        return m_sessions_count;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many shards the sessions are spread across.
+    inline u32
+    get_shards_count() const noexcept
+    {
+        return u32(m_shards.size());
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    inline u32
+    get_shard_index(SessionId session_id) const noexcept
+    {
+        return u32(session_id % m_shards.size());
+    }
+
+    inline Shard&
+    get_shard(SessionId session_id) noexcept
+    {
+        return *m_shards[get_shard_index(session_id)];
+    }
+
+    void apply_shard_moves(
+        Shard       &shard,
+        const Move  *p_moves,
+        const u32   *p_indexes,
+        u32          indexes_count,
+        MoveOutcome *p_outcomes) noexcept;
+
+    static MoveOutcome make_move(
+        Shard               &shard,
+        GameCore            &game,
+        GameCore::Direction  direction) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    ThreadPool *mp_pool;
+
+    std::vector<std::unique_ptr<Shard>> m_shards;
+
+    std::atomic<SessionId> m_next_session_id;
+    std::atomic<u32>       m_sessions_count;
+
+}; // class SessionHost
+
+NS_CORE2048_END
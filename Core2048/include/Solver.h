@@ -0,0 +1,269 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Solver.h                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <chrono>
+#include <utility>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+#include "acow/math_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "BitBoard.h"
+#include "BitBoardGameCore.h"
+#include "GameCore.h"
+#include "IValuesGenerator.h"
+#include "ThreadPool.h"
+#include "TranspositionTable.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Finds the best move of a 4x4 game with an expectimax search.
+/// @detail
+///   The search alternates between the player moves, where the best
+///   direction is taken, and the block generation, where every empty
+///   cell and every value that the IValuesGenerator might generate are
+///   weighted by their chances. Leaves are scored by a heuristic that
+///   favors empty cells, possible merges and monotonic rows / columns.  \n
+///   The search runs on BitBoards so each node is a plain u64 copy.     \n
+///   It can be limited by depth, by time or by both, with a time budget
+///   the search deepens one move at a time and returns the best move of
+///   the deepest search that finished on time.                          \n
+///   A TranspositionTable can be given to cache the generation nodes,
+///   so positions reached by different move orders are searched once.    \n
+///   With a ThreadPool the root is split in one task for each move, each
+///   empty cell and each generated value, and the tasks share the table.
+///   Without it the search runs in the calling thread and, for the same
+///   board and the same settings, always finds the same move.
+/// @see BitBoard, IValuesGenerator::get_values_chances(), TranspositionTable.
+class Solver
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef GameCore::Direction Direction;
+
+    ///-------------------------------------------------------------------------
+    /// @brief The default depth of search, in moves.
+    static constexpr u32 k_default_max_depth = 3;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Generation branches less likely than this are not expanded.
+    static constexpr f32 k_min_chance = 0.0001f;
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a Solver.
+    /// @param p_values_generator
+    ///    The generator that the game is using, the values that it
+    ///    might generate are taken from it for every search.
+    explicit Solver(IValuesGenerator *p_values_generator) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Sets how many moves the search looks ahead.
+    /// @see set_time_budget().
+    inline void
+    set_max_depth(u32 max_depth) noexcept
+    {
+        m_max_depth = acow::math::Max(max_depth, 1u);
+    }
+
+    constexpr inline u32
+    get_max_depth() const noexcept
+    {
+        return m_max_depth;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets how much time a search can take, 0 means no limit.
+    /// @note
+    ///    The first depth is always searched, so there's always a move
+    ///    to return even with tiny budgets.
+    /// @see set_max_depth().
+    inline void
+    set_time_budget(std::chrono::milliseconds time_budget) noexcept
+    {
+        m_time_budget = time_budget;
+    }
+
+    inline std::chrono::milliseconds
+    get_time_budget() const noexcept
+    {
+        return m_time_budget;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the table that caches the searched positions.
+    /// @param p_table
+    ///    The table, nullptr disables the caching. It isn't owned by
+    ///    the Solver and can be shared between many of them.
+    inline void
+    set_transposition_table(TranspositionTable *p_table) noexcept
+    {
+        mp_table = p_table;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Sets the threads that the search is split into.
+    /// @param p_pool
+    ///    The pool, nullptr makes the search run in the calling thread.
+    ///    It isn't owned by the Solver.
+    inline void
+    set_thread_pool(ThreadPool *p_pool) noexcept
+    {
+        mp_pool = p_pool;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Finds the best move of the board.
+    /// @returns
+    ///    The best direction, or Direction::None if there's no
+    ///    valid move at all.
+    Direction find_best_move(const BitBoard &board) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Finds the best move of a 4x4 GameCore.
+    /// @see BitBoard::from_game_core().
+    inline Direction
+    find_best_move(const GameCore &core) noexcept
+    {
+        return find_best_move(BitBoard::from_game_core(core));
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Finds the best move of a BitBoardGameCore.
+    inline Direction
+    find_best_move(const BitBoardGameCore &core) noexcept
+    {
+        return find_best_move(core.get_board());
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the expected score of the last move found.
+    constexpr inline f32
+    get_last_score() const noexcept
+    {
+        return m_last_score;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the depth that the last search actually reached.
+    constexpr inline u32
+    get_last_depth() const noexcept
+    {
+        return m_last_depth;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many nodes the last search evaluated.
+    constexpr inline u64
+    get_last_nodes_count() const noexcept
+    {
+        return m_nodes_count;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the heuristic score of the board.
+    /// @note Higher is better.
+    static f32 evaluate(const BitBoard &board) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+private:
+    // State of a single thread of search.
+    struct SearchContext
+    {
+        u64  nodes_count;
+        bool out_of_time;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    f32 search_root(
+        const BitBoard &board,
+        u32             depth,
+        Direction      *p_best_dir,
+        SearchContext  &context) const noexcept;
+
+    f32 search_root_parallel(
+        const BitBoard &board,
+        u32             depth,
+        Direction      *p_best_dir,
+        SearchContext  &context) const noexcept;
+
+    f32 search_max(
+        const BitBoard &board,
+        u32             depth,
+        f32             chance,
+        SearchContext  &context) const noexcept;
+
+    f32 search_chance(
+        const BitBoard &board,
+        u32             depth,
+        f32             chance,
+        SearchContext  &context) const noexcept;
+
+    bool is_out_of_time(SearchContext &context) const noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    typedef std::chrono::steady_clock Clock;
+
+    IValuesGenerator   *mp_values_generator;
+    TranspositionTable *mp_table;
+    ThreadPool         *mp_pool;
+
+    u32                       m_max_depth;
+    std::chrono::milliseconds m_time_budget;
+
+    // Generated values as exponents and their chances.
+    std::vector<std::pair<u32, f32>> m_chances;
+
+    Clock::time_point m_deadline;
+    u64               m_nodes_count;
+
+    f32 m_last_score;
+    u32 m_last_depth;
+
+}; // class Solver
+
+NS_CORE2048_END
@@ -0,0 +1,130 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : StaticGameCore.h                                              //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "GameCore.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Owns the generator of a StaticGameCore.
+/// @detail
+///   It's a base of StaticGameCore that comes before GameCore, so the
+///   generator exists when the GameCore constructor generates the first
+///   block.
+template <typename Generator>
+struct StaticGameCoreGenerator
+{
+    Generator m_values_generator;
+};
+
+///-----------------------------------------------------------------------------
+/// @brief A GameCore that owns a generator of a known type.
+/// @detail
+///   Its generate_next_block() calls the generator directly, so with a
+///   final generator, like StaticValuesGenerator, the value is generated
+///   without any virtual call and the spawn is inlined.              \n
+///   Everything else is the GameCore, calls through a GameCore reference
+///   still work but go through IValuesGenerator.
+/// @tparam Generator A default constructible IValuesGenerator.
+/// @see GameCore, StaticValuesGenerator.
+template <typename Generator>
+class StaticGameCore
+    : private StaticGameCoreGenerator<Generator>
+    , public  GameCore
+{
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs the game with its own generator.
+    /// @see GameCore::GameCore().
+    inline StaticGameCore(
+        u32    width,
+        u32    height,
+        i32    seed    = Random::kRandomSeed,
+        Arena *p_arena = nullptr) noexcept
+        : StaticGameCoreGenerator<Generator>()
+        , GameCore(&this->m_values_generator, width, height, seed, p_arena)
+    {
+        // Empty...
+    }
+
+    // The copies must use their own generators.
+    inline StaticGameCore(const StaticGameCore &other) noexcept
+        : StaticGameCoreGenerator<Generator>(other)
+        , GameCore(other)
+    {
+        set_values_generator(&this->m_values_generator);
+    }
+
+    inline StaticGameCore&
+    operator=(const StaticGameCore &other) noexcept
+    {
+        StaticGameCoreGenerator<Generator>::operator=(other);
+        GameCore::operator=(other);
+        set_values_generator(&this->m_values_generator);
+
+        return *this;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Keeps GameCore::generate_next_block(coord, value) visible,
+    ///   the one below would hide it otherwise.
+    using GameCore::generate_next_block;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Generates the new game block.
+    /// @detail
+    ///    Same as GameCore::generate_next_block(), the same seed gives
+    ///    the same blocks, but the generator isn't called through
+    ///    IValuesGenerator.
+    /// @see GameCore::generate_next_block().
+    inline const Block&
+    generate_next_block() noexcept
+    {
+        auto coord = pick_next_block_coord();
+        auto value = this->m_values_generator.generate_value(get_random());
+
+        return put_next_block(coord, value);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the generator of the game.
+    inline const Generator&
+    get_values_generator() const noexcept
+    {
+        return this->m_values_generator;
+    }
+
+}; // class StaticGameCore
+
+NS_CORE2048_END
@@ -0,0 +1,294 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : StaticValuesGenerator.h                                       //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <initializer_list>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+#include "CoreAssert/CoreAssert.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "IValuesGenerator.h"
+#include "ValuesTable.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief A values table that is built at compile time.
+/// @detail
+///   Rows are added with with_row(), that builds their alias tables with
+///   the same code of ValuesTable, so a constexpr table generates the
+///   same values of a ValuesTable loaded from the equivalent text file.
+/// @see StaticValuesGenerator, DefaultValuesTable, ValuesTable.
+struct StaticValuesTable
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr u32 k_rows_count      = ValuesTable::k_rows_count;
+    static constexpr u32 k_max_row_entries = 8;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    struct Chance
+    {
+        u32 value;
+        u32 percent;
+    };
+
+    struct Row
+    {
+        u32                entries_count;
+        ValuesTable::Entry entries[k_max_row_entries];
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    constexpr StaticValuesTable() noexcept
+        : rows{}
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets a copy of the table with the row of the max value.
+    /// @detail
+    ///   Same as a line of the text format, so
+    ///      8 |  2(80)  4(20)
+    ///   is with_row(8, {{2, 80}, {4, 20}}).
+    /// @note Invalid rows fail to compile when built at compile time.
+    constexpr StaticValuesTable
+    with_row(u32 max_value, std::initializer_list<Chance> chances)
+        const noexcept
+    {
+        auto table = *this;
+        auto count = u32(chances.size());
+        auto total = u64(0);
+
+        u32 values  [k_max_row_entries] = {};
+        u32 percents[k_max_row_entries] = {};
+        u64 weights [k_max_row_entries] = {};
+        u32 indices [k_max_row_entries] = {};
+
+        if(max_value < 2 || count == 0 || count > k_max_row_entries)
+            invalid_row(max_value);
+
+        for(auto i = 0u; i < count; ++i)
+        {
+            values  [i] = chances.begin()[i].value;
+            percents[i] = chances.begin()[i].percent;
+            total      += percents[i];
+        }
+
+        if(total == 0)
+            invalid_row(max_value);
+
+        auto &row = table.rows[31 - u32(__builtin_clz(max_value))];
+        row.entries_count = count;
+
+        ValuesTable::build_alias_entries(
+            values, percents, count, row.entries, weights, indices
+        );
+
+        return table;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the row of the max value, nullptr if it has no entries.
+    constexpr const Row*
+    get_row(u32 max_value) const noexcept
+    {
+        auto &row = rows[31 - u32(__builtin_clz(max_value))];
+        return (row.entries_count != 0) ? &row : nullptr;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    // Not constexpr, so calling it while building a table at compile time
+    // is an error.
+    static inline void
+    invalid_row(u32 max_value) noexcept
+    {
+        COREASSERT_ASSERT(
+            false,
+            "Invalid row for max value (%u).",
+            max_value
+        );
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+public:
+    Row rows[k_rows_count];
+
+}; // struct StaticValuesTable
+
+
+///-----------------------------------------------------------------------------
+/// @brief The table of resources/values.txt built at compile time.
+/// @detail
+///   Tables are types with a constexpr make() that gives the
+///   StaticValuesTable, they are the parameter of StaticValuesGenerator.
+struct DefaultValuesTable
+{
+    static constexpr StaticValuesTable
+    make() noexcept
+    {
+        return StaticValuesTable()
+            .with_row(   2, {{2, 100}})
+            .with_row(   4, {{2, 100}})
+            .with_row(   8, {{2,  80}, {4, 20}})
+            .with_row(  16, {{2,  70}, {4, 30}})
+            .with_row(  32, {{2,  60}, {4, 40}})
+            .with_row(  64, {{2,  70}, {4, 20}, {8, 10}})
+            .with_row( 128, {{2,  60}, {4, 25}, {8, 15}})
+            .with_row( 256, {{2,  50}, {4, 30}, {8, 20}})
+            .with_row( 512, {{2,  50}, {4, 25}, {8, 15}, {16, 10}})
+            .with_row(1024, {{2,  45}, {4, 25}, {8, 20}, {16, 10}})
+            .with_row(2048, {{2,  40}, {4, 25}, {8, 25}, {16, 10}})
+            .with_row(4096, {{2,  40}, {4, 20}, {8, 10}, {16, 10}, {32, 10}});
+    }
+};
+
+
+///-----------------------------------------------------------------------------
+/// @brief Generates the values of the blocks from a compile time table.
+/// @detail
+///   There's no file to read and the rows are looked up on a constexpr
+///   array. The class is final, so calls through a StaticValuesGenerator
+///   (like the ones of StaticGameCore) aren't virtual and are inlined.
+/// @tparam Table A type with a constexpr make(), like DefaultValuesTable.
+/// @see StaticValuesTable, StaticGameCore, PresetValuesGenerator.
+template <typename Table>
+class StaticValuesGenerator final
+    : public IValuesGenerator
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    static constexpr StaticValuesTable k_table = Table::make();
+
+
+    //------------------------------------------------------------------------//
+    // CTOR                                                                   //
+    //------------------------------------------------------------------------//
+public:
+    inline StaticValuesGenerator() noexcept
+        : m_max_value(0)
+        , mp_row     (nullptr)
+    {
+        // Empty...
+    }
+
+
+    //------------------------------------------------------------------------//
+    // IValuesGenerator Interface                                             //
+    //------------------------------------------------------------------------//
+public:
+    inline u32
+    generate_value(Random &rnd_gen) noexcept override
+    {
+        COREASSERT_ASSERT(
+            mp_row != nullptr,
+            "m_max_value(%d) don't exists... check your table.",
+            m_max_value
+        );
+
+        return ValuesTable::draw_value(
+            mp_row->entries, mp_row->entries_count, rnd_gen
+        );
+    }
+
+    inline void
+    set_max_value(u32 value) noexcept override
+    {
+        COREASSERT_ASSERT(
+            (value >= 2),
+            "value(%d) must be >= 2.",
+            value
+        );
+
+        m_max_value = value;
+        mp_row      = nullptr;
+
+        // Past the last row, like the PresetValuesGenerator.
+        for(auto row_value = value; row_value >= 2 && !mp_row; row_value >>= 1)
+            mp_row = k_table.get_row(row_value);
+    }
+
+    inline u32
+    get_max_value() const noexcept override
+    {
+        return m_max_value;
+    }
+
+    inline ValuesChances
+    get_values_chances() const noexcept override
+    {
+        COREASSERT_ASSERT(
+            mp_row != nullptr,
+            "m_max_value(%d) don't exists... check your table.",
+            m_max_value
+        );
+
+        auto chances = ValuesChances();
+        for(auto i = 0u; i < mp_row->entries_count; ++i)
+        {
+            auto &entry = mp_row->entries[i];
+            chances.push_back(std::make_pair(entry.value, entry.chance));
+        }
+
+        return chances;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    u32                           m_max_value;
+    const StaticValuesTable::Row *mp_row;
+
+}; // class StaticValuesGenerator
+
+template <typename Table>
+constexpr StaticValuesTable StaticValuesGenerator<Table>::k_table;
+
+NS_CORE2048_END
@@ -0,0 +1,156 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ThreadPool.h                                                  //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief A work stealing pool of threads.
+/// @detail
+///   Every worker has its own queue of tasks. Tasks submitted from inside
+///   of a task of the same pool go to the queue of its worker, the others
+///   are spread among the workers. Workers take the newest tasks of
+///   their own queues first and when they run out of tasks they steal
+///   the oldest ones from the queues of the other workers.               \n
+///   Tasks submitted to a given worker are never stolen, they're run by
+///   that worker in the order they were submitted.                      \n
+///   The thread that calls wait() helps running the tasks too.
+/// @see Solver::set_thread_pool().
+class ThreadPool
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    typedef std::function<void()> Task;
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+private:
+    struct Worker
+    {
+        std::mutex       mutex;
+        std::deque<Task> tasks;
+
+        // Submitted to this worker, they aren't counted as queued
+        // since no other thread can take them.
+        std::deque<Task> pinned_tasks;
+        std::atomic<u32> pinned_count;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs the pool and starts its threads.
+    /// @param threads_count
+    ///    How many threads the pool will have, 0 means one per each
+    ///    hardware thread.
+    explicit ThreadPool(u32 threads_count = 0) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Waits the pending tasks and stops the threads.
+    ~ThreadPool() noexcept;
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool& operator=(const ThreadPool &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Queues a task to be run by any of the threads.
+    void submit(Task task) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Queues a task to be run by the worker of the given index.
+    /// @detail
+    ///    Tasks that touch the same data can be always given to the
+    ///    same worker, so the data stays in the caches of its thread.
+    /// @param worker_index - In [0, get_threads_count()).
+    void submit_to(u32 worker_index, Task task) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Runs the queued tasks until all submitted tasks are done.
+    /// @note Must not be called from inside of a task.
+    void wait() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many threads the pool has.
+    inline u32
+    get_threads_count() const noexcept
+    {
+        return u32(m_threads.size());
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void worker_loop(u32 index) noexcept;
+
+    bool try_pop_pinned(u32 index, Task *p_task) noexcept;
+    bool try_pop       (u32 index, Task *p_task) noexcept;
+    bool try_steal     (u32 index, Task *p_task) noexcept;
+    bool try_run_one   (u32 index)               noexcept;
+
+    void notify_sleepers(bool all) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::vector<std::thread>             m_threads;
+
+    std::atomic<u32>  m_queued_count;  // Submitted but not taken.
+    std::atomic<u32>  m_pending_count; // Submitted but not finished.
+    std::atomic<u32>  m_next_worker;
+    std::atomic<bool> m_stopping;
+
+    std::mutex              m_sleep_mutex;
+    std::condition_variable m_sleep_cond;
+
+}; // class ThreadPool
+
+NS_CORE2048_END
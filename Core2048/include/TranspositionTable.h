@@ -0,0 +1,134 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TranspositionTable.h                                          //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <atomic>
+#include <cstddef>
+#include <memory>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Fixed size cache of evaluated board positions.
+/// @detail
+///   Entries are indexed by the Zobrist hash of the board and keep the
+///   evaluated value and the depth that it was searched to.             \n
+///   The table never allocates after construction, the caller decides
+///   how much memory it takes. When two positions fall in the same entry
+///   the one searched deeper is kept, unless the stored one is from an
+///   older search (see new_search()), which is always replaced.         \n
+///   Reads and writes are lock free, so a single table can be shared by
+///   many search threads. Each entry is stored as two words with the key
+///   xored with the data, so a torn entry (written by two threads at the
+///   same time) doesn't match its key and reads as a miss.
+/// @see Zobrist, Solver.
+class TranspositionTable
+{
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+private:
+    struct Entry
+    {
+        std::atomic<u64> key_xor_data;
+        std::atomic<u64> data;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Constructs a table that takes up to memory_size bytes.
+    /// @note The entries count is rounded down to a power of 2.
+    explicit TranspositionTable(std::size_t memory_size) noexcept;
+
+    TranspositionTable(const TranspositionTable &) = delete;
+    TranspositionTable& operator=(const TranspositionTable &) = delete;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Looks for the position in the table.
+    /// @param key - The Zobrist hash of the position.
+    /// @param min_depth - The minimum depth that the entry must have.
+    /// @param p_value - Where the value will be written if found.
+    /// @returns True if the entry was found, false otherwise.
+    bool probe(u64 key, u32 min_depth, f32 *p_value) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Stores the position, respecting the replacement policy.
+    /// @param key - The Zobrist hash of the position.
+    /// @param depth - The depth that the position was searched to.
+    /// @param value - The evaluated value.
+    void store(u64 key, u32 depth, f32 value) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief
+    ///   Marks the start of a new search, the current entries will
+    ///   still be found but any new entry can replace them.
+    inline void
+    new_search() noexcept
+    {
+        m_generation = u8(m_generation + 1);
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Removes all entries.
+    void clear() noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many entries the table has.
+    inline std::size_t
+    get_entries_count() const noexcept
+    {
+        return m_mask + 1;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets how many bytes the entries take.
+    inline std::size_t
+    get_memory_size() const noexcept
+    {
+        return get_entries_count() * sizeof(Entry);
+    }
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    std::unique_ptr<Entry[]> m_entries;
+    std::size_t              m_mask;
+    u8                       m_generation;
+
+}; // class TranspositionTable
+
+NS_CORE2048_END
@@ -0,0 +1,320 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ValuesTable.h                                                 //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <memory>
+#include <string>
+#include <vector>
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "Random.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief The compiled values table that PresetValuesGenerator draws from.
+/// @detail
+///   Each row of the text table (resources/values.txt) is compiled into an
+///   alias table (Walker's method), rows are kept in a flat array indexed
+///   by the log2 of the max value.                                       \n
+///   The compiled table can be saved in a binary format that is loaded
+///   by memory mapping the file and used as is, without any parsing.
+///   Loading the same binary file more than once in a process gives
+///   the same table, so all the generators share a single read only
+///   mapping.                                                            \n
+///   The binary format is:
+///     Header | Row[k_rows_count] | Entry[entries_count]
+///   in the native byte order, and the header has a checksum of the rest.
+/// @see PresetValuesGenerator, save_binary(), load().
+class ValuesTable
+{
+    //------------------------------------------------------------------------//
+    // Enums / Constants / Typedefs                                           //
+    //------------------------------------------------------------------------//
+public:
+    // Version of the binary format, files of other versions are rejected.
+    static constexpr u32 k_version = 1;
+
+    // One per bit of the max value.
+    static constexpr u32 k_rows_count = 32;
+
+    // Fixed point of the alias thresholds, the column and the threshold
+    // are drawn together as (column * k_alias_precision + fraction),
+    // that must fit in the positive range of the random numbers.
+    static constexpr u32 k_alias_precision_bits = 20;
+    static constexpr u32 k_alias_precision      = (1u << 20);
+    static constexpr u32 k_max_row_entries      = (1u << (31 - 20));
+
+
+    //------------------------------------------------------------------------//
+    // Inner Types                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief A value of a row, it's also the column of the alias table.
+    struct Entry
+    {
+        u32 threshold;   // Fractions below it give the value.
+        u32 value;
+        u32 alias_value; // Given by the other fractions.
+        f32 chance;      // Normalized chance of the value in its row.
+    };
+
+    ///-------------------------------------------------------------------------
+    /// @brief The entries of a max value, rows without entries are unused.
+    struct Row
+    {
+        u32 first_entry;
+        u32 entries_count;
+    };
+
+private:
+    struct Header
+    {
+        char magic[8];
+        u32  version;
+        u32  rows_count;
+        u32  entries_count;
+        u32  checksum;
+    };
+
+
+    //------------------------------------------------------------------------//
+    // Factories                                                              //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Loads a table from either a text or a binary file.
+    /// @detail
+    ///   Binary files are recognized by their magic number and are
+    ///   loaded with load_binary(), the others with load_text().
+    static std::shared_ptr<const ValuesTable>
+    load(const std::string &filename) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Parses and compiles a text table.
+    /// @note An example of such file is found in resouces/values.txt
+    static std::shared_ptr<const ValuesTable>
+    load_text(const std::string &filename) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Maps a binary table, checking its version and checksum.
+    /// @detail
+    ///   The rows are checked to be inside the entries too, so drawing
+    ///   from them never reads out of the file.                          \n
+    ///   While a table of the file is alive the next loads give it
+    ///   instead of mapping the file again. Files are told apart by
+    ///   their device, inode, modification time (in nanoseconds where
+    ///   the system has them) and size, not by name, so a file saved
+    ///   again is mapped again.
+    static std::shared_ptr<const ValuesTable>
+    load_binary(const std::string &filename) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Alias Tables                                                           //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Builds the alias table of a row (Vose's alias method).
+    /// @detail
+    ///   It's done with integers so the thresholds are exact up to
+    ///   k_alias_precision. Each column has a weight of (total) and each
+    ///   value contributes (percent * count) of it. Columns with less than
+    ///   (total) are filled by their alias, taken from the ones with more,
+    ///   that keep the rest of their weight.                             \n
+    ///   The percentages aren't required to sum up to 100, the chances
+    ///   are normalized against their summation, that must not be 0.
+    ///   It's constexpr so StaticValuesTable builds its rows with it too.
+    /// @param p_weights, p_indices Scratch arrays of count elements.
+    static constexpr void
+    build_alias_entries(
+        const u32 *p_values,
+        const u32 *p_percents,
+        u32        count,
+        Entry     *p_entries,
+        u64       *p_weights,
+        u32       *p_indices) noexcept
+    {
+        auto total = u64(0);
+        for(auto i = 0u; i < count; ++i)
+            total += p_percents[i];
+
+        // The smalls are stacked at the front of the indices and the
+        // larges at the back, each column is in one of them at most.
+        auto smalls_count = 0u;
+        auto larges_count = 0u;
+
+        for(auto i = 0u; i < count; ++i)
+        {
+            p_weights[i] = u64(p_percents[i]) * count;
+            p_entries[i] = Entry{
+                k_alias_precision,
+                p_values[i],
+                p_values[i],
+                f32(p_percents[i]) / f32(total)
+            };
+
+            if(p_weights[i] < total)
+                p_indices[smalls_count++] = i;
+            else
+                p_indices[count - ++larges_count] = i;
+        }
+
+        while(smalls_count != 0 && larges_count != 0)
+        {
+            auto small = p_indices[--smalls_count];
+            auto large = p_indices[count - larges_count];
+
+            p_entries[small].threshold =
+                u32(p_weights[small] * k_alias_precision / total);
+            p_entries[small].alias_value = p_values[large];
+
+            p_weights[large] -= (total - p_weights[small]);
+            if(p_weights[large] < total)
+            {
+                --larges_count;
+                p_indices[smalls_count++] = large;
+            }
+        }
+        // The weights sum up to (count * total) exactly, so whatever is
+        // left has (total) and never takes the alias.
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Draws a value from the alias table of a row.
+    /// @detail
+    ///   The column and the fraction that is checked against its threshold
+    ///   comes from the same random number, rows of a single value don't
+    ///   take any random number.
+    static inline u32
+    draw_value(
+        const Entry *p_entries,
+        u32          count,
+        Random      &rnd_gen) noexcept
+    {
+        if(count == 1)
+            return p_entries[0].value;
+
+        auto max   = count * k_alias_precision - 1;
+        auto rnd   = u32(rnd_gen.next(0, i32(max)));
+        auto entry = p_entries[rnd >> k_alias_precision_bits];
+
+        return ((rnd & (k_alias_precision - 1)) < entry.threshold)
+            ? entry.value
+            : entry.alias_value;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // CTOR / DTOR                                                            //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Unmaps the file of binary tables.
+    ~ValuesTable() noexcept;
+
+    ValuesTable(const ValuesTable &) = delete;
+    ValuesTable& operator=(const ValuesTable &) = delete;
+
+private:
+    ValuesTable() noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Public Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Writes the table in the binary format.
+    /// @detail
+    ///   The file is written as (filename).tmp and renamed over the
+    ///   old one, tables that have it mapped are left untouched.
+    /// @returns true if the whole file was written.
+    bool save_binary(const std::string &filename) const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the checksum of the table, same as on its binary file.
+    /// @detail Tables that give the same values have the same checksum.
+    /// @see GameRecord::Header.
+    u32 get_checksum() const noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the row of the max value, nullptr if it has no entries.
+    inline const Row*
+    get_row(u32 max_value) const noexcept
+    {
+        auto p_row = &mp_rows[31 - u32(__builtin_clz(max_value))];
+        return (p_row->entries_count != 0) ? p_row : nullptr;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the first entry of the row.
+    inline const Entry*
+    get_entries(const Row *p_row) const noexcept
+    {
+        return mp_entries + p_row->first_entry;
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets if the table is a mapping of a binary file.
+    inline bool
+    is_mapped() const noexcept
+    {
+        return mp_mapping != nullptr;
+    }
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    void add_row(u32 max_value, const std::vector<u32> &values,
+                 const std::vector<u32> &percents) noexcept;
+
+    static u32 calculate_checksum(
+        const void *p_data,
+        size_t      size,
+        u32         hash = 2166136261u) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // iVars                                                                  //
+    //------------------------------------------------------------------------//
+private:
+    // Text tables own their rows and entries.
+    std::vector<Row>   m_rows;
+    std::vector<Entry> m_entries;
+
+    // Binary tables point into the mapping.
+    void   *mp_mapping;
+    size_t  m_mapping_size;
+
+    const Row   *mp_rows;
+    const Entry *mp_entries;
+    u32          m_entries_count;
+
+}; // class ValuesTable
+
+NS_CORE2048_END
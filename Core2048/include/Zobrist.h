@@ -0,0 +1,108 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Zobrist.h                                                     //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// AmazingCow Libs
+#include "acow/cpp_goodies.h"
+#include "acow/math_goodies.h"
+// Core2048
+#include "Core2048_Utils.h"
+#include "BitBoard.h"
+#include "GameCore.h"
+
+
+NS_CORE2048_BEGIN
+
+///-----------------------------------------------------------------------------
+/// @brief Zobrist hashing of the game boards.
+/// @detail
+///   Every pair of cell and block exponent has a fixed random key and the
+///   hash of a board is the xor of the keys of its blocks, so changing a
+///   block costs two xors no matter how big the board is.               \n
+///   Keys only depend on the row major index of the cell, so the same
+///   board has the same hash as a GameCore and as a BitBoard.
+/// @see TranspositionTable, GameCore::get_hash().
+class Zobrist
+{
+    //------------------------------------------------------------------------//
+    // Static Methods                                                         //
+    //------------------------------------------------------------------------//
+public:
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the key of a block with exponent at the cell index.
+    static constexpr inline u64
+    get_key(u32 cell_index, u32 exponent) noexcept
+    {
+        // SplitMix64 finalizer, so keys don't need to be stored.
+        return mix(
+            (u64(cell_index) << 6 | exponent) * 0x9E3779B97F4A7C15ULL
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Gets the key of a block with value at the coord of a board.
+    static inline u64
+    get_key(
+        const acow::math::Coord &coord,
+        u32                      width,
+        u32                      value) noexcept
+    {
+        return get_key(
+            u32(coord.y) * width + u32(coord.x),
+            u32(__builtin_ctz(value))
+        );
+    }
+
+    ///-------------------------------------------------------------------------
+    /// @brief Computes the hash of the whole BitBoard.
+    static u64 hash(const BitBoard &board) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Computes the hash of the whole GameCore board.
+    static u64 hash(const GameCore &core) noexcept;
+
+    ///-------------------------------------------------------------------------
+    /// @brief Updates the hash with the changes of a move.
+    /// @param hash - The hash of the board before the move.
+    /// @param move_result - What make_move() returned.
+    /// @returns The hash of the board after the move.
+    /// @note
+    ///    Only the events of the moved, merged and removed blocks are
+    ///    visited, so this is way cheaper than hashing the board again.
+    static u64 update(
+        u64                         hash,
+        const GameCore::MoveResult &move_result) noexcept;
+
+
+    //------------------------------------------------------------------------//
+    // Private Methods                                                        //
+    //------------------------------------------------------------------------//
+private:
+    static constexpr inline u64
+    mix(u64 x) noexcept
+    {
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31);
+    }
+
+}; // class Zobrist
+
+NS_CORE2048_END
@@ -0,0 +1,136 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Arena.cpp                                                     //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Slab pool of memory for the games and its std allocator.                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Arena.h"
+// std
+#include <algorithm>
+#include <iterator>
+
+// Usings
+USING_NS_CORE2048;
+
+static_assert(
+    alignof(std::max_align_t) >= Arena::k_min_size,
+    "The chunks must be aligned to Arena::k_min_size."
+);
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+Arena::Arena(std::size_t chunk_size) noexcept
+    : m_chunk_size  (chunk_size)
+    , m_chunk_index (0)
+    , m_chunk_offset(0)
+    , m_chunks_size (0)
+    , m_used_size   (0)
+{
+    std::fill(std::begin(m_free_lists), std::end(m_free_lists), nullptr);
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+void*
+Arena::allocate(std::size_t size) noexcept
+{
+    auto size_class = get_class(size);
+    auto class_size = get_class_size(size_class);
+
+    m_used_size += class_size;
+
+    //--------------------------------------------------------------------------
+    // Freed memory of the class first.
+    auto &p_free = m_free_lists[size_class];
+    if(p_free)
+    {
+        auto p_node = p_free;
+        p_free = p_node->p_next;
+
+        return p_node;
+    }
+
+    return allocate_from_chunks(class_size);
+}
+
+void
+Arena::deallocate(void *p_memory, std::size_t size) noexcept
+{
+    if(!p_memory)
+        return;
+
+    auto size_class = get_class(size);
+    m_used_size -= get_class_size(size_class);
+
+    auto p_node = static_cast<FreeNode*>(p_memory);
+    p_node->p_next = m_free_lists[size_class];
+    m_free_lists[size_class] = p_node;
+}
+
+void
+Arena::reset() noexcept
+{
+    std::fill(std::begin(m_free_lists), std::end(m_free_lists), nullptr);
+
+    m_chunk_index  = 0;
+    m_chunk_offset = 0;
+    m_used_size    = 0;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+u8*
+Arena::allocate_from_chunks(std::size_t size) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The rest of the current chunk is left behind when it's too small,
+    // the next chunks are reused after a reset() if they are big enough.
+    while(m_chunk_index < m_chunks.size())
+    {
+        auto &chunk = m_chunks[m_chunk_index];
+        if(chunk.size - m_chunk_offset >= size)
+        {
+            auto p_memory = chunk.p_memory.get() + m_chunk_offset;
+            m_chunk_offset += size;
+
+            return p_memory;
+        }
+
+        ++m_chunk_index;
+        m_chunk_offset = 0;
+    }
+
+    //--------------------------------------------------------------------------
+    // A new chunk, new[] aligns it to the biggest fundamental alignment.
+    auto chunk_size = std::max(m_chunk_size, size);
+    m_chunks.push_back(Chunk{ std::unique_ptr<u8[]>(new u8[chunk_size]),
+                              chunk_size });
+    m_chunks_size += chunk_size;
+
+    m_chunk_index  = u32(m_chunks.size() -1);
+    m_chunk_offset = size;
+
+    return m_chunks.back().p_memory.get();
+}
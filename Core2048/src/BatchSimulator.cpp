@@ -0,0 +1,407 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BatchSimulator.cpp                                            //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BatchSimulator.h"
+// std
+#include <algorithm>
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_first_exponent   =  1u; // Games start with max value 2.
+constexpr auto k_victory_exponent = 11u; // 2048
+constexpr auto k_directions_count =  4;
+constexpr auto k_cells_count      = BitBoard::k_size * BitBoard::k_size;
+
+// Left, Up, Right, Down - Keeps the big blocks on the top left corner.
+constexpr BatchSimulator::Direction k_corner_directions[] = {
+    BatchSimulator::Direction::Left,
+    BatchSimulator::Direction::Up,
+    BatchSimulator::Direction::Right,
+    BatchSimulator::Direction::Down,
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// SplitMix64 - A single u64 of state, so each game can have its own.
+inline u64
+next_simulator_random(u64 &state) noexcept
+{
+    state += 0x9E3779B97F4A7C15ULL;
+
+    auto x = state;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+// Maps a random u64 to [0, range) without a division.
+inline u32
+simulator_random_below(u64 &state, u32 range) noexcept
+{
+    return u32(((next_simulator_random(state) >> 32) * range) >> 32);
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+BatchSimulator::BatchSimulator(IValuesGenerator *p_values_generator) noexcept
+    : mp_pool (nullptr)
+    , m_policy(Policy::Random)
+{
+    //--------------------------------------------------------------------------
+    // The chances are read by changing the max value of the generator,
+    // so it's set back afterwards.
+    auto previous_max_value = acow::math::Max(
+        p_values_generator->get_max_value(),
+        BitBoard::exponent_to_value(k_first_exponent)
+    );
+
+    //--------------------------------------------------------------------------
+    // Games go on after the victory, so every max value that the board
+    // can hold has its chances.
+    for(auto exponent = k_first_exponent;
+        exponent     <= BitBoard::k_max_exponent;
+        ++exponent)
+    {
+        p_values_generator->set_max_value(
+            BitBoard::exponent_to_value(exponent)
+        );
+
+        auto &exponents_chances = m_exponents_chances[exponent];
+        auto  cumulative        = 0.0f;
+
+        for(auto &value_chance : p_values_generator->get_values_chances())
+        {
+            cumulative += value_chance.second;
+            exponents_chances.push_back(std::make_pair(
+                BitBoard::value_to_exponent(value_chance.first),
+                cumulative
+            ));
+        }
+
+        COREASSERT_ASSERT(
+            !exponents_chances.empty(),
+            "No values chances for the max value (%d)",
+            BitBoard::exponent_to_value(exponent)
+        );
+    }
+
+    p_values_generator->set_max_value(previous_max_value);
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+void
+BatchSimulator::set_policy(Policy policy) noexcept
+{
+    COREASSERT_ASSERT(
+        policy != Policy::Callback,
+        "Policy::Callback is set with set_policy_callback()"
+    );
+
+    m_policy          = policy;
+    m_policy_callback = nullptr;
+}
+
+void
+BatchSimulator::set_policy_callback(const PolicyCallback &callback) noexcept
+{
+    COREASSERT_ASSERT(callback, "callback cannot be empty");
+
+    m_policy          = Policy::Callback;
+    m_policy_callback = callback;
+}
+
+//
+BatchSimulator::Stats
+BatchSimulator::run(u32 games_count, u64 seed) noexcept
+{
+    auto stats = Stats();
+    stats.games_count     = games_count;
+    stats.victories_count = 0;
+    stats.moves_count     = 0;
+
+    stats.scores      .resize(games_count);
+    stats.moves_counts.resize(games_count);
+    std::fill(
+        std::begin(stats.max_exponents_histogram),
+        std::end  (stats.max_exponents_histogram),
+        0
+    );
+
+    //--------------------------------------------------------------------------
+    // Each batch writes the per game results on its own range and
+    // counts the max exponents on its own histogram, so no locks.
+    constexpr auto histogram_size = BitBoard::k_max_exponent + 1;
+
+    auto batches_count = (games_count + k_batch_size -1) / k_batch_size;
+    auto histograms    = std::vector<u32>(batches_count * histogram_size, 0);
+
+    for(auto batch = 0u; batch < batches_count; ++batch)
+    {
+        auto first_game  = batch * k_batch_size;
+        auto batch_games = std::min(
+            u32(k_batch_size),
+            games_count - first_game
+        );
+        auto p_histogram = &histograms[batch * histogram_size];
+        auto p_stats     = &stats;
+
+        if(!mp_pool)
+        {
+            run_batch(seed, first_game, batch_games, stats, p_histogram);
+            continue;
+        }
+
+        mp_pool->submit([=]() {
+            run_batch(seed, first_game, batch_games, *p_stats, p_histogram);
+        });
+    }
+
+    if(mp_pool)
+        mp_pool->wait();
+
+    //--------------------------------------------------------------------------
+    // Gather the results.
+    for(auto batch = 0u; batch < batches_count; ++batch)
+    {
+        for(auto exponent = 0u; exponent < histogram_size; ++exponent)
+        {
+            auto count = histograms[batch * histogram_size + exponent];
+
+            stats.max_exponents_histogram[exponent] += count;
+            if(exponent >= k_victory_exponent)
+                stats.victories_count += count;
+        }
+    }
+
+    for(auto moves_count : stats.moves_counts)
+        stats.moves_count += moves_count;
+
+    return stats;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+BatchSimulator::run_batch(
+    u64    seed,
+    u32    first_game,
+    u32    games_count,
+    Stats &stats,
+    u32   *p_max_exponents_histogram) const noexcept
+{
+    BitBoard boards       [k_batch_size];
+    u64      randoms      [k_batch_size];
+    u32      max_exponents[k_batch_size];
+    u32      moves_counts [k_batch_size];
+    u32      active_games [k_batch_size];
+
+    //--------------------------------------------------------------------------
+    // Games start with a single block, like the GameCore.
+    for(auto i = 0u; i < games_count; ++i)
+    {
+        randoms[i] = seed ^ (u64(first_game + i) * 0xD1B54A32D192ED03ULL);
+        next_simulator_random(randoms[i]);
+
+        boards[i]        = BitBoard();
+        max_exponents[i] = std::max(
+            k_first_exponent,
+            generate_block(boards[i], k_first_exponent, randoms[i])
+        );
+        moves_counts [i] = 0;
+        active_games [i] = i;
+    }
+
+    //--------------------------------------------------------------------------
+    // Advance all the games that didn't end yet one move at a time.
+    auto active_count = games_count;
+    while(active_count != 0)
+    {
+        auto still_active_count = 0u;
+        for(auto j = 0u; j < active_count; ++j)
+        {
+            auto  i     = active_games[j];
+            auto &board = boards[i];
+
+            auto moved = board;
+            if(!pick_move(board, randoms[i], &moved))
+                continue;
+
+            ++moves_counts[i];
+
+            // A valid move always leaves an empty cell for the block.
+            auto max_exponent = std::max(max_exponents[i],
+                                         moved.get_max_exponent());
+            max_exponent = std::max(
+                max_exponent,
+                generate_block(moved, max_exponent, randoms[i])
+            );
+
+            board            = moved;
+            max_exponents[i] = max_exponent;
+
+            active_games[still_active_count++] = i;
+        }
+
+        active_count = still_active_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // Results.
+    for(auto i = 0u; i < games_count; ++i)
+    {
+        stats.scores      [first_game + i] = boards[i].get_values_sum();
+        stats.moves_counts[first_game + i] = moves_counts[i];
+
+        ++p_max_exponents_histogram[max_exponents[i]];
+    }
+}
+
+//
+bool
+BatchSimulator::pick_move(
+    const BitBoard &board,
+    u64            &random,
+    BitBoard       *p_moved) const noexcept
+{
+    switch(m_policy)
+    {
+        case Policy::Random: {
+            BitBoard valid_boards[k_directions_count];
+            auto     valid_count = 0u;
+
+            for(auto i = 0; i < k_directions_count; ++i)
+            {
+                auto moved = board.move(Direction(i));
+                if(moved != board)
+                    valid_boards[valid_count++] = moved;
+            }
+
+            if(valid_count == 0)
+                return false;
+
+            *p_moved = valid_boards[
+                simulator_random_below(random, valid_count)
+            ];
+            return true;
+        }
+
+        // Merges keep the summation of values, the score only grows when
+        // blocks are generated, so the greedy gain is the freed cells.
+        case Policy::Greedy: {
+            auto found            = false;
+            auto best_empty_count = 0u;
+
+            for(auto i = 0; i < k_directions_count; ++i)
+            {
+                auto moved = board.move(Direction(i));
+                if(moved == board)
+                    continue;
+
+                auto empty_count = moved.count_empty();
+                if(!found || empty_count > best_empty_count)
+                {
+                    found            = true;
+                    best_empty_count = empty_count;
+                    *p_moved         = moved;
+                }
+            }
+
+            return found;
+        }
+
+        case Policy::Corner: {
+            for(auto direction : k_corner_directions)
+            {
+                *p_moved = board.move(direction);
+                if(*p_moved != board)
+                    return true;
+            }
+
+            return false;
+        }
+
+        case Policy::Callback: {
+            *p_moved = board.move(m_policy_callback(board));
+            return *p_moved != board;
+        }
+    }
+
+    return false;
+}
+
+//
+u32
+BatchSimulator::generate_block(
+    BitBoard &board,
+    u32       max_exponent,
+    u64      &random) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Pick the nth empty cell.
+    auto empty_count = board.count_empty();
+    if(empty_count == 0)
+        return 0;
+
+    auto nth   = simulator_random_below(random, empty_count);
+    auto index = 0u;
+    for(; index < k_cells_count; ++index)
+    {
+        if(board.get_exponent_at_index(index) != 0)
+            continue;
+        if(nth-- == 0)
+            break;
+    }
+
+    //--------------------------------------------------------------------------
+    // Pick the exponent from the cumulative chances.
+    auto &exponents_chances = m_exponents_chances[max_exponent];
+    auto  chance            = (next_simulator_random(random) >> 40)
+                            * (1.0f / (1 << 24));
+
+    auto exponent = exponents_chances.back().first;
+    for(auto &exponent_chance : exponents_chances)
+    {
+        if(chance < exponent_chance.second)
+        {
+            exponent = exponent_chance.first;
+            break;
+        }
+    }
+
+    board = BitBoard(board.get_cells() | (u64(exponent) << (index * 4)));
+    return exponent;
+}
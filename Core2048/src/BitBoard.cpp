@@ -0,0 +1,220 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitBoard.cpp                                                  //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BitBoard.h"
+// std
+#include <sstream> //for ascii method
+#include <vector>
+// Core2048
+#include "../include/LineTable.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// Moved rows, the first half moved left and the second half moved right.
+// Just the lines of the LineTable, small enough to stay in the cache.
+const u16*
+get_moved_rows() noexcept
+{
+    constexpr auto k_rows_count = 1u << 16;
+
+    // Function statics are initialized only once, even with threads.
+    static const std::vector<u16> s_rows = []() {
+        auto rows = std::vector<u16>(2 * k_rows_count);
+        for(auto row = 0u; row < k_rows_count; ++row)
+        {
+            auto left  = BitBoard::move_row_left(u16(row));
+            auto right = BitBoard::reverse_row(
+                BitBoard::move_row_left(BitBoard::reverse_row(u16(row)))
+            );
+
+            rows[row               ] = left;
+            rows[row + k_rows_count] = right;
+        }
+
+        return rows;
+    }();
+
+    return s_rows.data();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+u32
+BitBoard::count_empty() const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Fold each nibble into its lowest bit, so that bit is set only
+    // for the non empty cells, and count the ones that aren't.
+    auto cells = m_cells;
+    cells |= (cells >> 2);
+    cells |= (cells >> 1);
+
+    return u32(__builtin_popcountll(~cells & 0x1111111111111111ULL));
+}
+
+u32
+BitBoard::get_max_exponent() const noexcept
+{
+    auto max_exponent = 0u;
+    for(auto i = 0u; i < k_size * k_size; ++i)
+    {
+        max_exponent = acow::math::Max(max_exponent, get_exponent_at_index(i));
+    }
+
+    return max_exponent;
+}
+
+u32
+BitBoard::get_values_sum() const noexcept
+{
+    auto sum = 0u;
+    for(auto i = 0u; i < k_size * k_size; ++i)
+        sum += exponent_to_value(get_exponent_at_index(i));
+
+    return sum;
+}
+
+
+//
+BitBoard
+BitBoard::move(GameCore::Direction direction) const noexcept
+{
+    if(direction == GameCore::Direction::None)
+        return *this;
+
+    //--------------------------------------------------------------------------
+    // Vertical moves are horizontal moves of the transposed board,
+    // Up is Left and Down is Right.
+    auto vertical = (direction == GameCore::Direction::Up ||
+                     direction == GameCore::Direction::Down);
+    auto reversed = (direction == GameCore::Direction::Right ||
+                     direction == GameCore::Direction::Down);
+
+    auto cells  = (vertical) ? transpose().m_cells : m_cells;
+    auto moved  = u64(0);
+    auto p_rows = get_moved_rows() + ((reversed) ? (1u << 16) : 0u);
+
+    for(auto y = 0u; y < k_size; ++y)
+    {
+        auto row = u16((cells >> (y * 16)) & 0xFFFF);
+        moved |= u64(p_rows[row]) << (y * 16);
+    }
+
+    return (vertical) ? BitBoard(moved).transpose() : BitBoard(moved);
+}
+
+BitBoard
+BitBoard::transpose() const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Swap the 2x2 blocks of nibbles off the diagonal first and then
+    // the nibbles inside of each 2x2 block.
+    auto a1 = m_cells & 0xF0F00F0FF0F00F0FULL;
+    auto a2 = m_cells & 0x0000F0F00000F0F0ULL;
+    auto a3 = m_cells & 0x0F0F00000F0F0000ULL;
+    auto a  = a1 | (a2 << 12) | (a3 >> 12);
+
+    auto b1 = a & 0xFF00FF0000FF00FFULL;
+    auto b2 = a & 0x00FF00FF00000000ULL;
+    auto b3 = a & 0x00000000FF00FF00ULL;
+
+    return BitBoard(b1 | (b2 >> 24) | (b3 << 24));
+}
+
+
+//
+std::string
+BitBoard::ascii() const noexcept
+{
+    std::stringstream ss;
+    for(auto y = 0u; y < k_size; ++y)
+    {
+        for(auto x = 0u; x < k_size; ++x)
+        {
+            auto index = y * k_size + x;
+            auto value = exponent_to_value(get_exponent_at_index(index));
+            if(value != 0)
+            {
+                ss << "[";
+
+                if(value < 100)
+                    ss << " ";
+                if(value < 10)
+                    ss << " ";
+
+                ss << value << "]";
+            }
+            else
+                ss << "[  ]";
+        }
+
+        ss << std::endl;
+    }
+
+    return ss.str();
+}
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+BitBoard
+BitBoard::from_game_core(const GameCore &core) noexcept
+{
+    COREASSERT_ASSERT(
+        core.get_width() == k_size && core.get_height() == k_size,
+        "Game must be %dx%d - It's %dx%d",
+        k_size, k_size,
+        core.get_width(), core.get_height()
+    );
+
+    auto board = BitBoard();
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(k_size); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(k_size); ++coord.x)
+        {
+            auto p_block = core.get_block_at(coord);
+            if(!p_block)
+                continue;
+
+            board.set_exponent_at(
+                coord,
+                value_to_exponent(p_block->get_value())
+            );
+        }
+    }
+
+    return board;
+}
+
+u16
+BitBoard::move_row_left(u16 row) noexcept
+{
+    return LineTable::get_transition(row).line;
+}
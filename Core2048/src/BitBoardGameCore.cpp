@@ -0,0 +1,142 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : BitBoardGameCore.cpp                                          //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/BitBoardGameCore.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_lesser_value  = 2u;
+constexpr auto k_victory_value = 2048u;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+BitBoardGameCore::BitBoardGameCore(
+    IValuesGenerator *p_values_generator,
+    i32 seed) noexcept
+    : mp_values_generator(p_values_generator)
+    , m_moves_count(0)
+    , m_max_value  (k_lesser_value)
+    , m_score      (0)
+    , m_status     (CoreGame::Status::Continue)
+    , m_random     (seed)
+{
+    mp_values_generator->set_max_value(m_max_value);
+    generate_next_block();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+acow::math::Coord
+BitBoardGameCore::generate_next_block() noexcept
+{
+    auto empty_count = m_board.count_empty();
+    COREASSERT_ASSERT(
+        empty_count != 0,
+        "Cannot generate a block on a full board"
+    );
+
+    //--------------------------------------------------------------------------
+    // Pick the nth empty cell, so a single random number is needed
+    // no matter how full the board is.
+    auto nth   = u32(m_random.next(empty_count -1));
+    auto index = 0u;
+    for(; index < BitBoard::k_size * BitBoard::k_size; ++index)
+    {
+        if(m_board.get_exponent_at_index(index) != 0)
+            continue;
+        if(nth-- == 0)
+            break;
+    }
+
+    auto coord = acow::math::Coord();
+    coord.y = index / BitBoard::k_size;
+    coord.x = index % BitBoard::k_size;
+
+    auto value = mp_values_generator->generate_value(m_random);
+    m_board.set_exponent_at(coord, BitBoard::value_to_exponent(value));
+
+    m_score    += value;
+    m_max_value = acow::math::Max(m_max_value, value);
+
+    check_status();
+    return coord;
+}
+
+//
+bool
+BitBoardGameCore::make_move(Direction direction) noexcept
+{
+    if(direction == Direction::None || m_status == CoreGame::Status::Defeat)
+        return false;
+
+    auto moved = m_board.move(direction);
+    if(moved == m_board)
+        return false;
+
+    m_board = moved;
+    ++m_moves_count;
+
+    //--------------------------------------------------------------------------
+    // Merges keep the summation of the values, so the score only
+    // changes when blocks are generated.
+    m_max_value = acow::math::Max(
+        m_max_value,
+        BitBoard::exponent_to_value(m_board.get_max_exponent())
+    );
+    mp_values_generator->set_max_value(m_max_value);
+
+    check_status();
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+BitBoardGameCore::check_status() noexcept
+{
+    if(m_max_value >= k_victory_value)
+    {
+        m_status = CoreGame::Status::Victory;
+    }
+    else if(m_board.count_empty() != 0    ||
+            is_valid_move(Direction::Left) ||
+            is_valid_move(Direction::Up  ))
+    {
+        // Left / Right and Up / Down are valid in pairs when the
+        // board is full, so there's no need to check the other two.
+        m_status = CoreGame::Status::Continue;
+    }
+    else
+    {
+        m_status = CoreGame::Status::Defeat;
+    }
+}
@@ -0,0 +1,85 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CountedRandom.cpp                                             //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/CountedRandom.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// CTOR                                                                       //
+//----------------------------------------------------------------------------//
+CountedRandom::CountedRandom(i32 seed) noexcept
+    : m_random      (seed)
+    , m_counter     (0)
+    , m_seed        (m_random.getSeed())
+    , m_using_random(m_random.isUsingRandomSeed())
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// CoreRandom::Random Interface                                               //
+//----------------------------------------------------------------------------//
+void
+CountedRandom::reseed(i32 seed) noexcept
+{
+    m_random.reseed(seed);
+
+    m_counter      = 0;
+    m_seed         = m_random.getSeed();
+    m_using_random = m_random.isUsingRandomSeed();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+void
+CountedRandom::set_counter(u64 counter) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The engine doesn't go back, the seed is the start of it all.
+    if(counter < m_counter)
+    {
+        m_random.reseed(m_seed);
+        m_counter = 0;
+    }
+
+    while(m_counter < counter)
+        next_bits();
+}
+
+void
+CountedRandom::set_state(const State &state) noexcept
+{
+    if(state.seed != m_seed)
+    {
+        m_random.reseed(state.seed);
+        m_counter = 0;
+        m_seed    = state.seed;
+    }
+
+    m_using_random = state.using_random;
+    set_counter(state.counter);
+}
@@ -0,0 +1,94 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : CounterRandom.cpp                                             //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/CounterRandom.h"
+// std
+#include <random>
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// CTOR                                                                       //
+//----------------------------------------------------------------------------//
+CounterRandom::CounterRandom(i32 seed, u64 stream) noexcept
+    : m_key         (0)
+    , m_counter     (0)
+    , m_stream      (stream)
+    , m_seed        (0)
+    , m_using_random(false)
+{
+    reseed(seed);
+}
+
+
+//----------------------------------------------------------------------------//
+// CoreRandom::Random Interface                                               //
+//----------------------------------------------------------------------------//
+void
+CounterRandom::reseed(i32 seed) noexcept
+{
+    m_using_random = (seed == kRandomSeed);
+    if(m_using_random)
+    {
+        // Never kRandomSeed, so get_seed() can reproduce the run.
+        seed = i32(std::random_device()() & 0x7FFFFFFF);
+    }
+
+    m_seed    = seed;
+    m_counter = 0;
+    m_key     = mix(mix(u64(u32(seed)) + k_gamma) ^ m_stream);
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+CounterRandom
+CounterRandom::split(u64 stream) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // The split is the stream 0 of a seed of its own, so its seed alone
+    // reproduces it, like for the games that are recorded and replayed.
+    // The gamma is odd, so its multiples modulo 2^31 don't repeat for
+    // the first 2^31 streams. Positive, so it's never kRandomSeed.
+    auto bits   = mix(m_key ^ k_gamma) + stream * k_gamma;
+    auto random = CounterRandom(i32(bits & 0x7FFFFFFF));
+    random.m_using_random = m_using_random;
+
+    return random;
+}
+
+void
+CounterRandom::fill(i32 *p_values, u32 count, i32 min, i32 max) noexcept
+{
+    auto key     = m_key;
+    auto counter = m_counter;
+
+    for(auto i = 0u; i < count; ++i)
+    {
+        auto bits   = mix(key + (counter + i + 1) * k_gamma);
+        p_values[i] = to_range(bits, min, max);
+    }
+
+    m_counter += count;
+}
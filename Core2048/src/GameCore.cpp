@@ -22,9 +22,15 @@
 #include "../include/GameCore.h"
 // std
 #include <cmath>     //pow
+#include <type_traits>
 #include <sstream>   //for ascii method
 #include <algorithm> //find
 #include <iterator>  //begin, end
+// Core2048
+#include "../include/GameRecordWriter.h"
+#include "../include/LineKernel.h"
+#include "../include/LineTable.h"
+#include "../include/Zobrist.h"
 
 // Usings
 USING_NS_CORE2048;
@@ -37,41 +43,10 @@ constexpr auto k_lesser_value  = 2;
 constexpr auto k_victory_value = 2048;
 
 
-//----------------------------------------------------------------------------//
-// Helper Functions                                                           //
-//----------------------------------------------------------------------------//
-template <typename T>
-std::tuple<int, int, int>
-for_values_helper(
-    const T                &container,
-    const acow::math::Coord &dir_coord)
-{
-    //--------------------------------------------------------------------------
-    // Assume that we're moving to Left or Up.
-    auto inclusive_begin = 0;
-    auto exclusive_end   = container.size(); // One past the end.
-    auto sum_value       = 1;
-
-    //--------------------------------------------------------------------------
-    // Adjust for Right or Down.
-    if(dir_coord.y > 0 || dir_coord.x > 0)
-    {
-        inclusive_begin = container.size() -1;
-        exclusive_end   = -1; //One past the end.
-        sum_value       = -1; //Will decrement the index...
-    }
-
-    return std::make_tuple(inclusive_begin, exclusive_end, sum_value);
-}
-
-acow::math::Coord
-direction_2_coord(GameCore::Direction dir) noexcept
-{
-    return (dir == GameCore::Direction::Up  ) ? acow::math::Coord::Up  () :
-           (dir == GameCore::Direction::Down) ? acow::math::Coord::Down() :
-           (dir == GameCore::Direction::Left) ? acow::math::Coord::Left() :
-                                                acow::math::Coord::Right();
-}
+static_assert(
+    std::is_trivially_copyable<GameCore::MoveResult>::value,
+    "MoveResult must be copied without allocating."
+);
 
 
 //----------------------------------------------------------------------------//
@@ -81,12 +56,45 @@ GameCore::GameCore(
     IValuesGenerator *p_values_generator,
     u32 width,
     u32 height,
-    i32 seed) noexcept
+    i32 seed,
+    Arena *p_arena) noexcept
+    : GameCore(p_values_generator, width, height, Random(seed), p_arena)
+{
+    // Empty...
+}
+
+GameCore::GameCore(
+    IValuesGenerator *p_values_generator,
+    u32 width,
+    u32 height,
+    const Random &random,
+    Arena *p_arena) noexcept
     : mp_values_generator(p_values_generator)
+    , m_blocks      (ArenaAllocator<Block>        (p_arena))
+    , m_free_handles(ArenaAllocator<Block::Handle>(p_arena))
+    , m_free_handles_count(0)
+    , m_cells       (ArenaAllocator<Block::Handle>(p_arena))
+    , m_width       (width)
+    , m_height      (height)
+    , m_moves_count (0)
+    , m_empty_cells (ArenaAllocator<u64>(p_arena))
     , m_max_value(k_lesser_value)
     , m_score    (0)
+    , m_hash     (0)
     , m_status   (CoreGame::Status::Continue)
-    , m_random   (seed)
+    , m_random   (random)
+    , m_move_engine(MoveEngine::Scan)
+    , m_move_events  (ArenaAllocator<MoveEvent>(p_arena))
+    , m_moved_count  (0)
+    , m_merged_count (0)
+    , m_removed_count(0)
+    , m_journal         (ArenaAllocator<JournalEntry>(p_arena))
+    , m_journal_capacity(0)
+    , m_journal_first   (0)
+    , m_journal_size    (0)
+    , m_journal_position(0)
+    , m_journal_open    (false)
+    , m_journal_random  (ArenaAllocator<Random>(p_arena))
 {
     COREASSERT_ASSERT(
         (width > 0 && height > 0),
@@ -96,39 +104,91 @@ GameCore::GameCore(
     );
 
     //Init board.
-    m_board.resize(height);
-    for(auto &line : m_board)
-        line.resize(width);
+    m_cells.resize(width * height, Block::Handle(Block::k_invalid_handle));
+
+    //--------------------------------------------------------------------------
+    // Init empty cells.
+    //   All of them at start.
+    auto cells_count = width * height;
+    m_empty_cells.resize((cells_count + 63) / 64, ~u64(0));
+    if(cells_count % 64 != 0)
+        m_empty_cells.back() = (u64(1) << (cells_count % 64)) -1;
+
+    m_empty_cells_count = cells_count;
+
+    //--------------------------------------------------------------------------
+    // Init blocks.
+    //   There's a block for each cell at most, since the array never
+    //   grows the blocks never move.
+    auto blocks_count = cells_count;
+    m_blocks.resize(blocks_count);
+
+    m_free_handles.resize(blocks_count);
+    for(auto handle = blocks_count; handle > 0; --handle)
+        release_handle(handle -1);
 
-    calculate_score_and_max_value();
-    generate_next_block          ();
+    //--------------------------------------------------------------------------
+    // Init move events.
+    m_move_events.resize(cells_count * 2);
+    clear_move_result();
+
+    mp_values_generator->set_max_value(m_max_value);
+    generate_next_block();
 }
 
 
 //----------------------------------------------------------------------------//
 // Public Methods                                                             //
 //----------------------------------------------------------------------------//
-const Block::SPtr
+const Block&
 GameCore::generate_next_block() noexcept
 {
-    auto coord = acow::math::Coord();
-    // COWTODO(n2omatt): Check if has empty blocks first...
-    while(1)
-    {
-        coord.y = m_random.next(m_board.size   () -1);
-        coord.x = m_random.next(m_board[0].size() -1);
+    auto coord = pick_next_block_coord();
+    auto value = mp_values_generator->generate_value(m_random);
 
-        // Empty block.
-        if(!get_block_at(coord))
-            break;
-    }
+    return put_next_block(coord, value);
+}
 
-    auto value   = mp_values_generator->generate_value(m_random);
-    auto p_block = std::make_shared<Block>(coord, value);
+const Block&
+GameCore::generate_next_block(const acow::math::Coord &coord, u32 value)
+    noexcept
+{
+    COREASSERT_ASSERT(
+        !get_block_at(coord),
+        "Cannot generate a block on the taken cell (%d,%d)",
+        coord.y,
+        coord.x
+    );
 
-    put_block_at(p_block->get_coord(), p_block);
+    if(m_journal_capacity != 0 && !m_journal_open)
+        begin_journal_entry();
 
-    return p_block;
+    return put_next_block(coord, value);
+}
+
+
+
+//
+void
+GameCore::get_empty_cells(std::vector<acow::math::Coord> *p_coords)
+    const noexcept
+{
+    p_coords->clear();
+    p_coords->reserve(m_empty_cells_count);
+
+    for(auto word_index = 0u; word_index < m_empty_cells.size(); ++word_index)
+    {
+        for(auto word = m_empty_cells[word_index]; word != 0; word &= word -1)
+        {
+            auto index = word_index * 64 + u32(__builtin_ctzll(word));
+
+            auto coord = acow::math::Coord();
+            coord.y = index / get_width();
+            coord.x = index % get_width();
+
+            p_coords->push_back(coord);
+        }
+    }
 }
 
 
@@ -136,12 +196,7 @@ GameCore::generate_next_block() noexcept
 const GameCore::MoveResult&
 GameCore::make_move(Direction direction) noexcept
 {
-    //--------------------------------------------------------------------------
-    // Clear the previous data.
-    m_move_result.moved_blocks  .clear();
-    m_move_result.merged_blocks .clear();
-    m_move_result.removed_blocks.clear();
-    m_move_result.move_valid = false;
+    clear_move_result();
 
     //--------------------------------------------------------------------------
     // Check if move is valid.
@@ -152,30 +207,208 @@ GameCore::make_move(Direction direction) noexcept
         return m_move_result;
     }
 
+    if(m_journal_capacity != 0)
+        begin_journal_entry();
+
     //--------------------------------------------------------------------------
     // Merge the blocks and move them.
-    auto dir_coord  = direction_2_coord(direction);
-    auto for_values = for_values_helper(m_board, dir_coord);
-
-    for(int i  = std::get<0>(for_values);
-            i != std::get<1>(for_values);
-            i += std::get<2>(for_values))
+    if(can_use_line_table(direction))
     {
-        auto &line = m_board[i];
-
-        merge(line, dir_coord);
-        move (line, dir_coord);
+        move_with_line_table(direction);
+    }
+    else if(can_use_line_kernel(direction))
+    {
+        move_with_line_kernel(direction);
     }
+    else
+    {
+        move_with_scan(direction);
+    }
+
+    fill_move_events();
 
     ++m_moves_count;
+    m_hash = Zobrist::update(m_hash, m_move_result);
+
+    //--------------------------------------------------------------------------
+    // Merges keep the summation of the values, so the score only changes
+    // when blocks are generated, but they might make a new max value.
+    for(auto &event : m_move_result.merged_blocks)
+        update_max_value(event.new_value);
+
+    check_status();
 
-    calculate_score_and_max_value();
-    check_status                 ();
+    if(m_journal_capacity != 0)
+        record_move_cells();
+    if(m_record_writer.p_writer)
+        m_record_writer.p_writer->on_move(direction);
 
     m_move_result.move_valid = true;
     return m_move_result;
 }
 
+//
+void
+GameCore::set_journal_capacity(u32 turns_count) noexcept
+{
+    COREASSERT_ASSERT(
+        get_width() * get_height() <= (1u << 24),
+        "Boards of more than 2^24 cells can't be journaled."
+    );
+
+    m_journal.clear();
+    m_journal.shrink_to_fit();
+    m_journal_random.clear();
+    m_journal_random.shrink_to_fit();
+
+    m_journal_capacity = turns_count;
+    m_journal_first    = 0;
+    m_journal_size     = 0;
+    m_journal_position = 0;
+    m_journal_open     = false;
+}
+
+bool
+GameCore::undo() noexcept
+{
+    if(!can_undo())
+        return false;
+
+    --m_journal_position;
+    apply_journal_entry(get_journal_entry(m_journal_position), true);
+
+    return true;
+}
+
+bool
+GameCore::redo() noexcept
+{
+    if(!can_redo())
+        return false;
+
+    apply_journal_entry(get_journal_entry(m_journal_position), false);
+    ++m_journal_position;
+
+    return true;
+}
+
+//
+GameCore::Snapshot
+GameCore::snapshot() const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Built at once, the state of a CounterRandom is a CounterRandom that
+    // a default construction would seed for nothing.
+    auto snapshot = Snapshot{
+        get_width (),
+        get_height(),
+        0,
+        nullptr,
+        m_moves_count,
+        m_max_value,
+        m_score,
+        m_hash,
+        m_status,
+        m_random.get_state()
+    };
+
+    //--------------------------------------------------------------------------
+    // Small boards fit on a word, with a nibble for each cell.
+    auto cells_count = get_width() * get_height();
+    if(cells_count <= 16 && m_max_value <= (1 << 15))
+    {
+        auto shift = 0u;
+        for_each_coord([&](const acow::math::Coord &coord) {
+            snapshot.small_cells |= u64(get_cell_exponent(coord)) << shift;
+            shift += 4;
+        });
+    }
+    else
+    {
+        auto p_cells = std::make_shared<std::vector<u8>>(cells_count);
+        auto p_cell  = p_cells->data();
+        for_each_coord([&](const acow::math::Coord &coord) {
+            *p_cell++ = u8(get_cell_exponent(coord));
+        });
+
+        snapshot.p_cells = std::move(p_cells);
+    }
+
+    return snapshot;
+}
+
+void
+GameCore::restore(const Snapshot &snapshot) noexcept
+{
+    COREASSERT_ASSERT(
+        snapshot.width  == get_width() && snapshot.height == get_height(),
+        "Snapshot size (%d, %d) differs of the game size (%d, %d).",
+        snapshot.width,
+        snapshot.height,
+        get_width (),
+        get_height()
+    );
+
+    clear_move_result();
+
+    if(snapshot.p_cells)
+    {
+        auto p_cell = snapshot.p_cells->data();
+        for_each_coord([&](const acow::math::Coord &coord) {
+            set_cell(coord, *p_cell++);
+        });
+    }
+    else
+    {
+        auto cells = snapshot.small_cells;
+        for_each_coord([&](const acow::math::Coord &coord) {
+            set_cell(coord, u32(cells & 0xF));
+            cells >>= 4;
+        });
+    }
+
+    restore_state(
+        snapshot.moves_count,
+        snapshot.max_value,
+        snapshot.score,
+        snapshot.hash,
+        snapshot.status
+    );
+
+    m_random.set_state(snapshot.random);
+}
+
+void
+GameCore::fork(GameCore *p_game) const noexcept
+{
+    COREASSERT_ASSERT(
+        p_game->get_width() == get_width() &&
+        p_game->get_height() == get_height(),
+        "Fork size (%d, %d) differs of the game size (%d, %d).",
+        p_game->get_width (),
+        p_game->get_height(),
+        get_width (),
+        get_height()
+    );
+
+    p_game->clear_move_result();
+
+    for_each_coord([&](const acow::math::Coord &coord) {
+        p_game->set_cell(coord, get_cell_exponent(coord));
+    });
+
+    p_game->restore_state(
+        m_moves_count,
+        m_max_value,
+        m_score,
+        m_hash,
+        m_status
+    );
+
+    p_game->m_random      = m_random;
+    p_game->m_move_engine = m_move_engine;
+}
+
 
 
 //
@@ -185,17 +418,12 @@ GameCore::is_valid_move(Direction direction) const noexcept
     if(direction == Direction::None)
         return false;
 
-    auto dir_coord = direction_2_coord(direction);
-    for(auto &line : m_board)
-    {
-        if(can_move_line (line, dir_coord) ||
-           can_merge_line(line, dir_coord))
-        {
-            return true;
-        }
-    }
+    if(can_use_line_table(direction))
+        return is_valid_move_with_line_table(direction);
+    if(can_use_line_kernel(direction))
+        return is_valid_move_with_line_kernel(direction);
 
-    return false;
+    return is_valid_move_with_scan(direction);
 }
 
 
@@ -204,12 +432,13 @@ std::string
 GameCore::ascii() const noexcept
 {
     std::stringstream ss;
-    for(auto &line : m_board)
+    for(auto &line : get_board())
     {
-        for(auto p_block : line)
+        for(auto handle : line)
         {
-            if(p_block)
+            if(handle != Block::k_invalid_handle)
             {
+                auto p_block = &m_blocks[handle];
                 ss << "[";
 
                 if(p_block->get_value() < 100)
@@ -230,236 +459,764 @@ GameCore::ascii() const noexcept
 }
 
 
+//----------------------------------------------------------------------------//
+// Protected Methods                                                          //
+//----------------------------------------------------------------------------//
+acow::math::Coord
+GameCore::pick_next_block_coord() noexcept
+{
+    COREASSERT_ASSERT(
+        m_empty_cells_count != 0,
+        "Cannot generate a block on a full board"
+    );
+
+    // Blocks that aren't generated after a move are turns of their own,
+    // the random state must be taken before drawing.
+    if(m_journal_capacity != 0 && !m_journal_open)
+        begin_journal_entry();
+
+    auto nth = u32(m_random.next(m_empty_cells_count -1));
+    return get_nth_empty_cell(nth);
+}
+
+const Block&
+GameCore::put_next_block(const acow::math::Coord &coord, u32 value) noexcept
+{
+    auto p_block = create_block(coord, value);
+
+    put_block_at(p_block->get_coord(), p_block);
+
+    m_score += value;
+    update_max_value(value);
+
+    m_hash ^= Zobrist::get_key(coord, get_width(), value);
+
+    // A block on the last empty cell might leave no moves left.
+    check_status();
+
+    if(m_journal_open)
+    {
+        auto &entry = get_journal_entry(m_journal_position -1);
+        entry.cells.push_back(get_cell_index(coord) << 8);
+    }
+    if(m_record_writer.p_writer)
+        m_record_writer.p_writer->on_block(get_cell_index(coord), value);
+
+    return *p_block;
+}
+
+
 //----------------------------------------------------------------------------//
 // Private Methods                                                            //
 //----------------------------------------------------------------------------//
+Block*
+GameCore::create_block(const acow::math::Coord &coord, u32 value) noexcept
+{
+    COREASSERT_ASSERT(
+        m_free_handles_count != 0,
+        "There's no free blocks left"
+    );
+
+    auto handle = m_free_handles[--m_free_handles_count];
+
+    m_blocks[handle] = Block(coord, value);
+    return &m_blocks[handle];
+}
+
 void
-GameCore::merge(const Line &line, const acow::math::Coord &dir_coord) noexcept
+GameCore::clear_move_result() noexcept
 {
-    auto for_values = for_values_helper(line, dir_coord);
-    for(int i  = std::get<0>(for_values);
-            i != std::get<1>(for_values);
-            i += std::get<2>(for_values))
+    //--------------------------------------------------------------------------
+    // The moved and merged blocks are still on the cells they went to.
+    //   The events are read from the game ones, since the MoveResult of
+    //   a copy of the game points to the events of the original.
+    auto reset_old_states = [this](u32 first, u32 count) {
+        for(auto i = first; i < first + count; ++i)
+        {
+            auto handle = m_cells[m_move_events[i].to];
+            m_blocks[handle].reset_old_state();
+        }
+    };
+
+    reset_old_states(0,                         m_moved_count );
+    reset_old_states(get_merged_events_first(), m_merged_count);
+
+    m_moved_count   = 0;
+    m_merged_count  = 0;
+    m_removed_count = 0;
+
+    update_move_result();
+    m_move_result.move_valid = false;
+}
+
+void
+GameCore::fill_move_events() noexcept
+{
+    auto fill_events = [this](u32 first, u32 count) {
+        for(auto i = first; i < first + count; ++i)
+        {
+            auto &event = m_move_events[i];
+            auto &block = m_blocks[event.from];
+
+            event = MoveEvent {
+                get_cell_index(block.get_old_coord()),
+                get_cell_index(block.get_coord    ()),
+                block.get_old_value(),
+                block.get_value    ()
+            };
+        }
+    };
+
+    //--------------------------------------------------------------------------
+    // The removed blocks aren't needed anymore once theirs events are
+    // filled, so theirs handles are released right away.
+    auto removed_first = get_removed_events_first();
+    for(auto i = removed_first; i < removed_first + m_removed_count; ++i)
+        release_handle(m_move_events[i].from);
+
+    fill_events(0,                         m_moved_count  );
+    fill_events(get_merged_events_first(), m_merged_count );
+    fill_events(removed_first,             m_removed_count);
+
+    update_move_result();
+}
+
+void
+GameCore::update_move_result() noexcept
+{
+    auto p_events = m_move_events.data();
+
+    m_move_result.moved_blocks   = MoveEvents { p_events, m_moved_count };
+    m_move_result.merged_blocks  = MoveEvents {
+        p_events + get_merged_events_first(),
+        m_merged_count
+    };
+    m_move_result.removed_blocks = MoveEvents {
+        p_events + get_removed_events_first(),
+        m_removed_count
+    };
+}
+
+//
+void
+GameCore::begin_journal_entry() noexcept
+{
+    //--------------------------------------------------------------------------
+    // The undone turns are dropped, and the oldest one if it's full.
+    m_journal_size = m_journal_position;
+    if(m_journal_size == m_journal_capacity)
     {
-        auto p_block = line[i];
+        m_journal_first = (m_journal_first + 1) % m_journal_capacity;
+        --m_journal_size;
+        --m_journal_position;
 
-        //----------------------------------------------------------------------
-        // Empty block.
-        if(!p_block)
-            continue;
+        // The random goes to the new oldest turn, that is done.
+        if(m_journal_size != 0)
+        {
+            m_journal_random[0].set_counter(
+                get_journal_entry(0).random_counter
+            );
+        }
+    }
 
-        //----------------------------------------------------------------------
-        // Already merged at this turn
-        //   Cannot merge twice...
-        if(is_already_merged(p_block))
-            continue;
+    if(m_journal_size == 0 && m_journal_random.empty())
+        m_journal_random.push_back(m_random);
+    else if(m_journal_size == 0)
+        m_journal_random[0] = m_random;
 
-        auto p_target_block = find_first_same_value_block(p_block, dir_coord);
+    auto index = (m_journal_first + m_journal_size) % m_journal_capacity;
+    if(index == m_journal.size())
+    {
+        m_journal.push_back(JournalEntry{
+            Vector<u32>(ArenaAllocator<u32>(get_arena())),
+            0, 0, 0, 0, m_status, 0
+        });
+    }
 
-        //----------------------------------------------------------------------
-        // No blocks with same value at this line.
-        if(p_target_block == nullptr)
-            continue;
+    ++m_journal_size;
+    ++m_journal_position;
+    m_journal_open = true;
 
-        //----------------------------------------------------------------------
-        // Trying to merge with a block that is already merged
-        //   But then again, blocks can only merge once per turn.
-        if(is_already_merged(p_target_block))
-            continue;
+    //--------------------------------------------------------------------------
+    // The state before the turn, the cells are recorded as they change.
+    auto &entry = m_journal[index];
+    entry.cells.clear();
+    entry.moves_count    = m_moves_count;
+    entry.max_value      = m_max_value;
+    entry.score          = m_score;
+    entry.hash           = m_hash;
+    entry.status         = m_status;
+    entry.random_counter = m_random.get_counter();
+}
 
-        //----------------------------------------------------------------------
-        // Resetting the src block and doubling the target block
-        // has the effect of merging them.
-        reset_block_at(p_block->get_coord());
-        p_target_block->set_value(p_target_block->get_value() * 2);
+void
+GameCore::record_move_cells() noexcept
+{
+    auto &cells = get_journal_entry(m_journal_position -1).cells;
+
+    //--------------------------------------------------------------------------
+    // Each cell had a single block before the move, so the old coords of
+    // the changed blocks have all the cells that were left or merged.
+    //   Blocks that moved and merged are on both lists.
+    for(auto p_events : { &m_move_result.moved_blocks,
+                          &m_move_result.merged_blocks,
+                          &m_move_result.removed_blocks })
+    {
+        for(auto &event : *p_events)
+        {
+            cells.push_back(
+                event.from << 8 | u32(__builtin_ctz(event.old_value))
+            );
+        }
+    }
 
-        m_move_result.merged_blocks.push_back (p_target_block);
-        m_move_result.removed_blocks.push_back(p_block);
+    std::sort(cells.begin(), cells.end());
+    cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+    //--------------------------------------------------------------------------
+    // The cells that the blocks moved to that weren't any of those
+    // were empty.
+    auto olds_count = cells.size();
+    for(auto &event : m_move_result.moved_blocks)
+    {
+        auto cell   = event.to << 8;
+        auto olds   = cells.begin() + olds_count;
+        auto it     = std::lower_bound(cells.begin(), olds, cell);
+
+        if(it == olds || (*it >> 8) != (cell >> 8))
+            cells.push_back(cell);
     }
 }
 
-bool
-GameCore::move(const Line &line, const acow::math::Coord &dir_coord) noexcept
+void
+GameCore::apply_journal_entry(JournalEntry &entry, bool backwards) noexcept
 {
-    bool moved = false;
+    COREASSERT_ASSERT(
+        !m_record_writer.p_writer,
+        "Recorded games can't be undone or redone."
+    );
+
+    clear_move_result();
+    m_journal_open = false;
 
-    auto for_values = for_values_helper(line, dir_coord);
-    for(int i  = std::get<0>(for_values);
-            i != std::get<1>(for_values);
-            i += std::get<2>(for_values))
+    //--------------------------------------------------------------------------
+    // The blocks generated after a move might be on the cells that it
+    // left, so the cells are swapped in the reverse order to go back.
+    if(backwards)
     {
-        auto p_block = line[i];
+        for(auto it = entry.cells.rbegin(); it != entry.cells.rend(); ++it)
+            swap_cell(*it);
+    }
+    else
+    {
+        for(auto &cell : entry.cells)
+            swap_cell(cell);
+    }
 
-        //----------------------------------------------------------------------
-        // Empty block.
-        if(!p_block)
-            continue;
+    std::swap(m_moves_count, entry.moves_count);
+    std::swap(m_max_value,   entry.max_value  );
+    std::swap(m_score,       entry.score      );
+    std::swap(m_hash,        entry.hash       );
+    std::swap(m_status,      entry.status     );
 
-        auto target_coord = find_last_empty_coord(p_block, dir_coord);
+    auto random_counter = m_random.get_counter();
+    rewind_random(entry.random_counter);
+    entry.random_counter = random_counter;
 
-        //----------------------------------------------------------------------
-        // No empty blocks.
-        if(target_coord == p_block->get_coord())
-            continue;
+    if(m_max_value != entry.max_value)
+        mp_values_generator->set_max_value(m_max_value);
+}
+
+void
+GameCore::rewind_random(u64 counter) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Turns are undone down to the oldest one at most, so the random
+    // of the journal is never past them.
+    if(counter < m_random.get_counter())
+        m_random = m_journal_random[0];
 
-        reset_block_at(p_block->get_coord());
-        put_block_at  (target_coord, p_block);
+    m_random.set_counter(counter);
+}
+
+void
+GameCore::swap_cell(u32 &cell) noexcept
+{
+    auto index = cell >> 8;
 
-        m_move_result.moved_blocks.push_back(p_block);
-        moved = true;
+    auto coord = acow::math::Coord();
+    coord.y = index / get_width();
+    coord.x = index % get_width();
+
+    cell = (index << 8) | set_cell(coord, cell & 0xFF);
+}
+
+u32
+GameCore::set_cell(const acow::math::Coord &coord, u32 exponent) noexcept
+{
+    auto old_exponent = get_cell_exponent(coord);
+    if(old_exponent == exponent)
+        return old_exponent;
+
+    //--------------------------------------------------------------------------
+    // The block of the cell is released and a new one is created,
+    // blocks don't keep theirs identities across undo, redo and restores.
+    auto handle = m_cells[get_cell_index(coord)];
+    if(handle != Block::k_invalid_handle)
+    {
+        reset_block_at(coord);
+        release_handle(handle);
     }
 
-    return moved;
+    if(exponent != 0)
+        put_block_at(coord, create_block(coord, 1u << exponent));
+
+    return old_exponent;
 }
 
+void
+GameCore::restore_state(
+    int               moves_count,
+    int               max_value,
+    int               score,
+    u64               hash,
+    CoreGame::Status  status) noexcept
+{
+    COREASSERT_ASSERT(
+        !m_record_writer.p_writer,
+        "Recorded games can't be restored."
+    );
+
+    if(m_max_value != max_value)
+        mp_values_generator->set_max_value(max_value);
+
+    m_moves_count = moves_count;
+    m_max_value   = max_value;
+    m_score       = score;
+    m_hash        = hash;
+    m_status      = status;
+
+    //--------------------------------------------------------------------------
+    // The turns on the journal don't lead to this state anymore.
+    m_journal_size     = 0;
+    m_journal_position = 0;
+    m_journal_open     = false;
+}
+
+acow::math::Coord
+GameCore::get_nth_empty_cell(u32 nth) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Skip the whole words first and then the bits of the word.
+    auto word_index = 0u;
+    while(true)
+    {
+        auto count = u32(__builtin_popcountll(m_empty_cells[word_index]));
+        if(nth < count)
+            break;
+
+        nth -= count;
+        ++word_index;
+    }
+
+    auto word = m_empty_cells[word_index];
+    for(; nth != 0; --nth)
+        word &= word -1;
+
+    auto index = word_index * 64 + u32(__builtin_ctzll(word));
+
+    auto coord = acow::math::Coord();
+    coord.y = index / get_width();
+    coord.x = index % get_width();
+
+    return coord;
+}
+
+//
+void
+GameCore::move_with_scan(Direction direction) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Columns are walked with the same strided views as rows, so the
+    // vertical moves take the same path of the horizontal ones.
+    auto lines_count = get_lines_count(direction);
+    for(auto index = 0u; index < lines_count; ++index)
+        merge_and_move_line(get_line(direction, index));
+}
 
 bool
-GameCore::can_merge_line(
-    const Line             &line,
-    const acow::math::Coord &dir_coord) const noexcept
+GameCore::is_valid_move_with_scan(Direction direction) const noexcept
 {
+    auto lines_count = get_lines_count(direction);
+    for(auto index = 0u; index < lines_count; ++index)
+    {
+        if(can_change_line(get_line(direction, index)))
+            return true;
+    }
 
-    for(auto p_block : line)
+    return false;
+}
+
+//
+void
+GameCore::merge_and_move_line(const Line &line) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The blocks are taken from the cell 0 onwards, each one is merged
+    // with the last block that was put in the line or is put next to it.
+    Block *p_last_block  = nullptr;
+    auto   last_index    = 0u;
+    auto   last_merged   = false;
+
+    for(auto i = 0u; i < line.size(); ++i)
     {
         //----------------------------------------------------------------------
         // Empty block.
-        if(!p_block)
+        if(line[i] == Block::k_invalid_handle)
             continue;
 
+        auto p_block = &m_blocks[line[i]];
+
         //----------------------------------------------------------------------
-        // Check if can merge.
-        auto p_target_block = find_first_same_value_block(p_block, dir_coord);
-        if(p_target_block)
-            return true;
-    }
+        // Resetting the src block and doubling the target block
+        // has the effect of merging them.
+        //   But blocks can only merge once per turn.
+        if(p_last_block && !last_merged &&
+           p_last_block->get_value() == p_block->get_value())
+        {
+            reset_block_at(get_cell_coord(&line[i]));
+            p_last_block->set_value(p_last_block->get_value() * 2);
+            last_merged = true;
 
-    return false;
-}
+            add_merged_event (p_last_block);
+            add_removed_event(p_block);
+            continue;
+        }
 
+        auto target_index = (p_last_block) ? last_index + 1 : 0;
+        if(target_index != i)
+        {
+            reset_block_at(get_cell_coord(&line[i]));
+            put_block_at  (get_cell_coord(&line[target_index]), p_block);
+
+            add_moved_event(p_block);
+        }
+
+        p_last_block = p_block;
+        last_index   = target_index;
+        last_merged  = false;
+    }
+}
 
 bool
-GameCore::can_move_line(
-    const Line              &line,
-    const acow::math::Coord &dir_coord) const noexcept
+GameCore::can_change_line(const ConstLine &line) const noexcept
 {
-    for(auto p_block : line)
+    auto last_value = 0u;
+    auto has_empty  = false;
+
+    for(auto i = 0u; i < line.size(); ++i)
     {
+        auto handle = line[i];
+
         //----------------------------------------------------------------------
         // Empty block.
-        if(!p_block)
+        if(handle == Block::k_invalid_handle)
+        {
+            has_empty = true;
             continue;
+        }
 
         //----------------------------------------------------------------------
-        // Check if can move.
-        auto target_coord = find_last_empty_coord(p_block, dir_coord);
-        if(target_coord != p_block->get_coord())
+        // Block that can move to an empty cell or merge with the last one.
+        auto value = m_blocks[handle].get_value();
+        if(has_empty || value == last_value)
             return true;
+
+        last_value = value;
     }
 
     return false;
 }
 
 
+
 //
-Block::SPtr
-GameCore::find_first_same_value_block(
-    Block::SPtr            p_src_block,
-    const acow::math::Coord &dir_coord) const noexcept
+bool
+GameCore::can_use_line_table(Direction direction) const noexcept
 {
-    COREASSERT_ASSERT(
-        p_src_block != nullptr,
-        "p_src_block cannot be nullptr"
-    );
+    if(m_move_engine != MoveEngine::LineTable)
+        return false;
+
+    //--------------------------------------------------------------------------
+    // The table doesn't merge the blocks of its max exponent, the other
+    // engines do, so boards that have them must not use it.
+    if(m_max_value >= (1 << LineTable::k_max_exponent))
+        return false;
+
+    return get_line_size(direction) == LineTable::k_line_size;
+}
+
+bool
+GameCore::can_use_line_kernel(Direction direction) const noexcept
+{
+    if(m_move_engine != MoveEngine::LineKernel)
+        return false;
+
+    return get_line_size(direction) <= LineKernel::k_max_line_size;
+}
+
+//
+u32
+GameCore::get_line_size(Direction direction) const noexcept
+{
+    return (direction == Direction::Left || direction == Direction::Right)
+        ? m_width
+        : m_height;
+}
+
+u32
+GameCore::get_lines_count(Direction direction) const noexcept
+{
+    return (direction == Direction::Left || direction == Direction::Right)
+        ? m_height
+        : m_width;
+}
+
+//
+template <typename Handle>
+u16
+GameCore::pack_line(const LineView<Handle> &line) const noexcept
+{
+    auto packed = u16(0);
+    for(auto i = 0u; i < LineTable::k_line_size; ++i)
+    {
+        auto handle = line[i];
+        if(handle == Block::k_invalid_handle)
+            continue;
 
-    auto curr_coord = p_src_block->get_coord();
+        auto exponent = u32(__builtin_ctz(m_blocks[handle].get_value()));
+        packed |= u16(exponent << (i * 4));
+    }
+
+    return packed;
+}
 
-    while(1)
+template <typename Handle>
+void
+GameCore::pack_line_bytes(const LineView<Handle> &line, u8 *p_line)
+    const noexcept
+{
+    std::fill(p_line + line.size(), p_line + LineKernel::k_max_line_size, 0);
+    for(auto i = 0u; i < line.size(); ++i)
     {
-        curr_coord += dir_coord;
+        auto handle = line[i];
+        p_line[i] = (handle != Block::k_invalid_handle)
+            ? u8(__builtin_ctz(m_blocks[handle].get_value()))
+            : 0;
+    }
+}
 
-        //----------------------------------------------------------------------
-        // Outside board bounds.
-        if(!is_valid_coord(curr_coord))
-            return nullptr;
+//
+void
+GameCore::apply_line_transition(
+    const Line &line,
+    const u8   *p_targets,
+    u64         moved_mask,
+    u64         merged_mask,
+    u64         removed_mask) noexcept
+{
+    Block *blocks[LineKernel::k_max_line_size];
 
-        auto p_curr_block = get_block_at(curr_coord);
+    //--------------------------------------------------------------------------
+    // Take all blocks out of the line first, so they can be put back
+    // in any order without overwriting each other.
+    for(auto i = 0u; i < line.size(); ++i)
+    {
+        auto handle = line[i];
+        blocks[i] = (handle != Block::k_invalid_handle) ? &m_blocks[handle]
+                                                        : nullptr;
+        reset_block_at(get_cell_coord(&line[i]));
+    }
+
+    for(auto i = 0u; i < line.size(); ++i)
+    {
+        auto p_block = blocks[i];
+        auto mask    = (u64(1) << i);
 
         //----------------------------------------------------------------------
         // Empty block.
-        if(!p_curr_block)
+        if(!p_block)
             continue;
 
         //----------------------------------------------------------------------
-        // Same value blocks.
-        if(p_curr_block->get_value() == p_src_block->get_value())
+        // Merged into another block.
+        if(removed_mask & mask)
         {
-            return p_curr_block;
+            add_removed_event(p_block);
+            continue;
+        }
+
+        if(merged_mask & mask)
+        {
+            p_block->set_value(p_block->get_value() * 2);
+            add_merged_event(p_block);
         }
+
         //----------------------------------------------------------------------
-        // Found a block with different value.
-        //   Don't need to keep searching...
+        // Blocks that didn't move keep theirs old coords.
+        if(moved_mask & mask)
+        {
+            put_block_at(get_cell_coord(&line[p_targets[i]]), p_block);
+            add_moved_event(p_block);
+        }
         else
         {
-            return nullptr;
+            put_block_at(get_cell_coord(&line[i]), p_block);
         }
     }
-
-    return nullptr;
 }
 
-acow::math::Coord
-GameCore::find_last_empty_coord(
-    Block::SPtr            p_src_block,
-    const acow::math::Coord &dir_coord) const noexcept
+//
+void
+GameCore::move_with_line_table(Direction direction) noexcept
 {
-    COREASSERT_ASSERT(
-        p_src_block != nullptr,
-        "p_src_block cannot be nullptr"
-    );
+    auto lines_count = get_lines_count(direction);
 
-    auto curr_coord = p_src_block->get_coord();
-    while(1)
+    u8 targets[LineTable::k_line_size];
+    for(auto index = 0u; index < lines_count; ++index)
     {
-        curr_coord += dir_coord;
+        auto  line       = get_line(direction, index);
+        auto  packed     = pack_line(line);
+        auto &transition = LineTable::get_transition(packed);
 
         //----------------------------------------------------------------------
-        // At edge of Board.
-        if(!is_valid_coord(curr_coord))
-            return curr_coord + (dir_coord * -1);
+        // Nothing changes on this line.
+        if(transition.line == packed)
+            continue;
 
-        auto p_curr_block = get_block_at(curr_coord);
+        for(auto i = 0u; i < LineTable::k_line_size; ++i)
+            targets[i] = u8(transition.get_target(i));
 
-        if(p_curr_block)
-            return curr_coord + (dir_coord * -1);
+        apply_line_transition(
+            line,
+            targets,
+            transition.moved_mask,
+            transition.merged_mask,
+            transition.removed_mask
+        );
     }
+}
 
-    COREASSERT_ASSERT(false, "Cannot be here");
+bool
+GameCore::is_valid_move_with_line_table(Direction direction) const noexcept
+{
+    auto lines_count = get_lines_count(direction);
+    for(auto index = 0u; index < lines_count; ++index)
+    {
+        auto packed = pack_line(get_line(direction, index));
+        if(LineTable::get_transition(packed).line != packed)
+            return true;
+    }
+
+    return false;
 }
 
+//
+void
+GameCore::move_with_line_kernel(Direction direction) noexcept
+{
+    auto lines_count = get_lines_count(direction);
+
+    u8                     packed[LineKernel::k_max_line_size];
+    LineKernel::Transition transition;
+
+    for(auto index = 0u; index < lines_count; ++index)
+    {
+        auto line = get_line(direction, index);
+        pack_line_bytes(line, packed);
+
+        LineKernel::move_line(packed, &transition);
+
+        //----------------------------------------------------------------------
+        // Nothing changes on this line.
+        if((transition.moved_mask | transition.removed_mask) == 0)
+            continue;
+
+        apply_line_transition(
+            line,
+            transition.targets,
+            transition.moved_mask,
+            transition.merged_mask,
+            transition.removed_mask
+        );
+    }
+}
+
+bool
+GameCore::is_valid_move_with_line_kernel(Direction direction) const noexcept
+{
+    auto lines_count = get_lines_count(direction);
+
+    u8                     packed[LineKernel::k_max_line_size];
+    LineKernel::Transition transition;
+
+    for(auto index = 0u; index < lines_count; ++index)
+    {
+        pack_line_bytes(get_line(direction, index), packed);
+
+        LineKernel::move_line(packed, &transition);
+        if((transition.moved_mask | transition.removed_mask) != 0)
+            return true;
+    }
+
+    return false;
+}
 
 
 //
 void
-GameCore::calculate_score_and_max_value() noexcept
+GameCore::update_max_value(u32 value) noexcept
 {
-    m_score     = 0;
-    m_max_value = k_lesser_value;
+    if(int(value) <= m_max_value)
+        return;
+
+    m_max_value = value;
+    mp_values_generator->set_max_value(m_max_value);
+}
 
-    for(auto &line : m_board)
+bool
+GameCore::has_equal_neighbours() const noexcept
+{
+    //--------------------------------------------------------------------------
+    // Each cell is compared with the ones at its right and below,
+    // that covers all pairs of neighbours.
+    auto width   = get_width ();
+    auto height  = get_height();
+    auto p_cells = m_cells.data();
+
+    for(auto y = 0u; y < height; ++y)
     {
-        for(auto p_block : line)
+        for(auto x = 0u; x < width; ++x, ++p_cells)
         {
-            if(!p_block)
+            auto handle = *p_cells;
+            if(handle == Block::k_invalid_handle)
                 continue;
 
-            auto value = p_block->get_value();
+            auto value    = m_blocks[handle].get_value();
+            auto is_equal = [&](Block::Handle other) {
+                return other != Block::k_invalid_handle
+                    && m_blocks[other].get_value() == value;
+            };
 
-            m_score     += value;
-            m_max_value  = acow::math::Max(m_max_value, value);
+            if((x +1 < width  && is_equal(p_cells[1]    )) ||
+               (y +1 < height && is_equal(p_cells[width])))
+            {
+                return true;
+            }
         }
     }
 
-    mp_values_generator->set_max_value(m_max_value);
+    return false;
 }
 
 void
@@ -469,10 +1226,10 @@ GameCore::check_status() noexcept
     {
         m_status = CoreGame::Status::Victory;
     }
-    else if(is_valid_move(Direction::Up   ) ||
-            is_valid_move(Direction::Down ) ||
-            is_valid_move(Direction::Left ) ||
-            is_valid_move(Direction::Right))
+    //--------------------------------------------------------------------------
+    // Blocks can always slide to an empty cell, so only full boards
+    // need to be looked at, and then only merges are possible.
+    else if(m_empty_cells_count != 0 || has_equal_neighbours())
     {
         m_status = CoreGame::Status::Continue;
     }
@@ -0,0 +1,232 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordArchive.cpp                                         //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    An append only file of GameRecords with an index.                       //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/GameRecordArchive.h"
+// std
+#include <cstring>
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+// Core2048
+#include "../include/GameRecordReader.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr char k_index_magic[8] = { 'C', '2', '0', '4', '8', 'G', 'I', '\0' };
+
+// Version of the index file, indexes of other versions are rebuilt.
+constexpr u32 k_index_version = 1;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+GameRecordArchive::GameRecordArchive(const std::string &filename) noexcept
+    : m_filename      (filename)
+    , m_index_filename(filename + ".idx")
+    , m_size          (0)
+    , m_appending     (false)
+    , m_record_game_id(0)
+{
+    m_out.open(m_filename, std::ios::binary | std::ios::app);
+    m_in .open(m_filename, std::ios::binary);
+
+    if(m_in.seekg(0, std::ios::end))
+        m_size = u64(m_in.tellg());
+
+    if(!load_index())
+        write_index();
+
+    m_index_out.open(m_index_filename, std::ios::binary | std::ios::app);
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+std::ostream*
+GameRecordArchive::begin_record(u64 game_id) noexcept
+{
+    COREASSERT_ASSERT(!m_appending, "A record is already being appended.");
+
+    m_appending      = true;
+    m_record_game_id = game_id;
+
+    return &m_out;
+}
+
+bool
+GameRecordArchive::end_record() noexcept
+{
+    COREASSERT_ASSERT(m_appending, "No record is being appended.");
+    m_appending = false;
+
+    //--------------------------------------------------------------------------
+    // Appends always go to the end, so that is where the record ends.
+    m_out.flush();
+    auto end = m_out.tellp();
+    if(!m_out || end < 0)
+        return false;
+
+    auto entry = IndexEntry{m_record_game_id, m_size};
+    add_entry(entry);
+
+    m_index_out.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+    m_index_out.flush();
+
+    m_size = u64(end);
+    return bool(m_index_out);
+}
+
+std::istream*
+GameRecordArchive::seek_record(u32 nth) noexcept
+{
+    COREASSERT_ASSERT(
+        nth < m_index.size(),
+        "Record (%u) is not on the archive.",
+        nth
+    );
+
+    m_in.clear();
+    m_in.seekg(std::streamoff(m_index[nth].offset));
+
+    return &m_in;
+}
+
+bool
+GameRecordArchive::find(u64 game_id, u32 *p_nth) const noexcept
+{
+    auto it = m_game_ids.find(game_id);
+    if(it == m_game_ids.end())
+        return false;
+
+    *p_nth = it->second;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+bool
+GameRecordArchive::load_index() noexcept
+{
+    std::ifstream in_stream(m_index_filename, std::ios::binary);
+
+    auto header = IndexHeader();
+
+    auto is_valid = in_stream.read(reinterpret_cast<char*>(&header),
+                                   sizeof(header))
+        && memcmp(header.magic, k_index_magic, sizeof(k_index_magic)) == 0
+        && header.version    == k_index_version
+        && header.entry_size == sizeof(IndexEntry);
+
+    //--------------------------------------------------------------------------
+    // Entries are taken while they're in order and inside the file.
+    auto entry = IndexEntry();
+    while(is_valid &&
+          in_stream.read(reinterpret_cast<char*>(&entry), sizeof(entry)))
+    {
+        if(entry.offset >= m_size ||
+           (!m_index.empty() && entry.offset <= m_index.back().offset))
+        {
+            is_valid = false;
+            break;
+        }
+
+        add_entry(entry);
+    }
+
+    if(in_stream.gcount() != 0)
+        is_valid = false;
+
+    //--------------------------------------------------------------------------
+    // The last record is scanned again to find where it ends, the ones
+    // after it weren't indexed.
+    auto entries_count = m_index.size();
+    auto offset        = u64(0);
+    if(!m_index.empty())
+    {
+        offset = m_index.back().offset;
+
+        auto it = m_game_ids.find(m_index.back().game_id);
+        if(it->second == m_index.size() -1)
+            m_game_ids.erase(it);
+
+        m_index.pop_back();
+    }
+
+    scan_records(offset);
+
+    return is_valid && m_index.size() == entries_count;
+}
+
+void
+GameRecordArchive::scan_records(u64 offset) noexcept
+{
+    auto turn = GameRecordReader::Turn();
+    while(offset < m_size)
+    {
+        m_in.clear();
+        m_in.seekg(std::streamoff(offset));
+
+        GameRecordReader reader(&m_in);
+        while(reader.read_turn(&turn))
+            continue;
+
+        if(!reader.is_complete())
+            break;
+
+        add_entry(IndexEntry{reader.get_header().game_id, offset});
+        offset += reader.get_size();
+    }
+}
+
+void
+GameRecordArchive::add_entry(const IndexEntry &entry) noexcept
+{
+    m_game_ids.emplace(entry.game_id, u32(m_index.size()));
+    m_index.push_back(entry);
+}
+
+void
+GameRecordArchive::write_index() noexcept
+{
+    auto header = IndexHeader();
+    memcpy(header.magic, k_index_magic, sizeof(k_index_magic));
+    header.version    = k_index_version;
+    header.entry_size = sizeof(IndexEntry);
+
+    std::ofstream out_stream(
+        m_index_filename,
+        std::ios::binary | std::ios::trunc
+    );
+    out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_stream.write(
+        reinterpret_cast<const char*>(m_index.data()),
+        m_index.size() * sizeof(IndexEntry)
+    );
+}
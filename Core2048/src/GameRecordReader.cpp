@@ -0,0 +1,433 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordReader.cpp                                          //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streams the turns of a GameRecord and replays them.                     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/GameRecordReader.h"
+// std
+#include <algorithm>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+// Core2048
+#include "../include/Zobrist.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Same as the biggest board that can be journaled.
+constexpr auto k_max_cells_count = u64(1) << 24;
+
+// A block is a varint of (cell_index << 5), 5 bytes on the biggest board.
+constexpr auto k_max_block_size = u64(5);
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+GameRecordReader::GameRecordReader(std::istream *p_stream) noexcept
+    : mp_stream(p_stream)
+    , m_header ()
+    , m_footer ()
+    , m_chunk_moves_count(0)
+    , m_chunk_move       (0)
+    , m_blocks_offset    (0)
+    , m_moves_count      (0)
+    , m_checksum         (GameRecord::get_empty_checksum())
+    , m_size             (0)
+    , m_valid            (true)
+    , m_complete         (false)
+{
+    read_header();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+bool
+GameRecordReader::read_turn(Turn *p_turn) noexcept
+{
+    if(!m_valid || m_complete)
+        return false;
+
+    if(m_chunk_move == m_chunk_moves_count && !read_chunk())
+        return false;
+
+    auto shift = (m_chunk_move % 4) * 2;
+    p_turn->direction = GameCore::Direction(
+        (m_moves[m_chunk_move / 4] >> shift) & 3
+    );
+
+    p_turn->blocks.clear();
+    if(m_header.spawns == GameRecord::Spawns::Cells &&
+       !read_blocks(m_blocks, &m_blocks_offset, &p_turn->blocks))
+    {
+        return false;
+    }
+
+    ++m_chunk_move;
+    ++m_moves_count;
+
+    // The blocks of a chunk end with its last turn.
+    if(m_chunk_move == m_chunk_moves_count &&
+       m_blocks_offset != m_blocks.size())
+    {
+        return fail();
+    }
+
+    return true;
+}
+
+bool
+GameRecordReader::replay(GameCore *p_game) noexcept
+{
+    if(!m_valid)
+        return false;
+
+    if(p_game->get_width () != m_header.width ||
+       p_game->get_height() != m_header.height)
+    {
+        return false;
+    }
+
+    auto is_seed = (m_header.spawns == GameRecord::Spawns::Seed);
+
+    //--------------------------------------------------------------------------
+    // Seed records need the game that they were recorded with, that
+    // generates the initial blocks again.
+    if(is_seed)
+    {
+        if(p_game->get_moves_count() != 0 ||
+           p_game->get_seed() != m_header.seed)
+        {
+            return false;
+        }
+
+        auto cells_count  = m_header.width * m_header.height;
+        auto blocks_count = m_initial_blocks.size();
+        auto board_count  = [&]() {
+            return cells_count - p_game->get_empty_cells_count();
+        };
+
+        while(board_count() < blocks_count && board_count() < cells_count)
+            p_game->generate_next_block();
+
+        if(board_count() != blocks_count)
+            return fail();
+
+        for(const auto &block : m_initial_blocks)
+        {
+            auto coord = acow::math::Coord();
+            coord.y = block.cell_index / m_header.width;
+            coord.x = block.cell_index % m_header.width;
+
+            auto p_block = p_game->get_block_at(coord);
+            if(!p_block || p_block->get_value() != block.value)
+                return fail();
+        }
+    }
+    //--------------------------------------------------------------------------
+    // Cells records replace the board with theirs initial blocks.
+    else
+    {
+        auto cells_count = m_header.width * m_header.height;
+        auto exponents   = std::vector<u8>(cells_count, 0);
+
+        auto snapshot = p_game->snapshot();
+        snapshot.small_cells = 0;
+        snapshot.moves_count = 0;
+        snapshot.max_value   = 2;
+        snapshot.score       = 0;
+        snapshot.hash        = 0;
+        snapshot.status      = CoreGame::Status::Continue;
+
+        for(const auto &block : m_initial_blocks)
+        {
+            auto exponent = u32(__builtin_ctz(block.value));
+            if(exponents[block.cell_index] != 0)
+                return fail();
+
+            exponents[block.cell_index] = u8(exponent);
+
+            snapshot.max_value = std::max(snapshot.max_value,
+                                          int(block.value));
+            snapshot.score    += block.value;
+            snapshot.hash     ^= Zobrist::get_key(block.cell_index, exponent);
+        }
+
+        //----------------------------------------------------------------------
+        // Exponents of the records fit in the nibbles of small boards.
+        snapshot.p_cells = nullptr;
+        if(cells_count <= 16)
+        {
+            for(auto index = 0u; index < cells_count; ++index)
+                snapshot.small_cells |= u64(exponents[index]) << (index * 4);
+        }
+        else
+        {
+            snapshot.p_cells = std::make_shared<const std::vector<u8>>(
+                std::move(exponents)
+            );
+        }
+
+        p_game->restore(snapshot);
+    }
+
+    //--------------------------------------------------------------------------
+    // The block of a seed record turn is generated when the next turn
+    // is read, the footer tells if the last turn has one.
+    auto turn       = Turn();
+    auto has_block  = false;
+    auto put_blocks = [&]() {
+        if(has_block)
+        {
+            if(p_game->get_empty_cells_count() == 0)
+                return false;
+
+            p_game->generate_next_block();
+            has_block = false;
+        }
+
+        for(const auto &block : turn.blocks)
+        {
+            auto coord = acow::math::Coord();
+            coord.y = block.cell_index / m_header.width;
+            coord.x = block.cell_index % m_header.width;
+
+            if(p_game->get_block_at(coord))
+                return false;
+
+            p_game->generate_next_block(coord, block.value);
+        }
+
+        return true;
+    };
+
+    while(read_turn(&turn))
+    {
+        if(is_seed && !put_blocks())
+            return fail();
+        if(!p_game->make_move(turn.direction).move_valid)
+            return fail();
+        if(!is_seed && !put_blocks())
+            return fail();
+
+        has_block = is_seed;
+    }
+
+    if(!m_complete)
+        return false;
+
+    turn.blocks.clear();
+    has_block = (is_seed && m_footer.blocks_count == m_footer.moves_count
+                         && m_footer.moves_count != 0);
+    if(!put_blocks())
+        return fail();
+
+    return p_game->get_moves_count() == m_footer.moves_count
+        && p_game->get_score      () == m_footer.score
+        && p_game->get_max_value  () == m_footer.max_value
+        && p_game->get_hash       () == m_footer.hash
+        && u32(p_game->get_status()) == m_footer.status;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+bool
+GameRecordReader::read_header() noexcept
+{
+    if(!read(&m_header, sizeof(m_header)))
+        return false;
+
+    auto cells_count = u64(m_header.width) * m_header.height;
+    auto is_valid    =
+        memcmp(m_header.magic, GameRecord::get_magic(), 8) == 0
+        && m_header.version == GameRecord::k_version
+        && (m_header.spawns == GameRecord::Spawns::Seed ||
+            m_header.spawns == GameRecord::Spawns::Cells)
+        && (m_header.random == GameRecord::Randoms::Counted ||
+            m_header.random == GameRecord::Randoms::Counter)
+        // The blocks of the seed records are only the same with the
+        // same Random.
+        && (m_header.spawns == GameRecord::Spawns::Cells ||
+            m_header.random == GameRecord::k_random)
+        && cells_count != 0
+        && cells_count <= k_max_cells_count
+        && m_header.initial_blocks_size <= cells_count * k_max_block_size;
+
+    if(!is_valid)
+        return fail();
+
+    auto bytes = std::vector<u8>(m_header.initial_blocks_size);
+    if(!read(bytes.data(), bytes.size()))
+        return false;
+
+    //--------------------------------------------------------------------------
+    // The initial blocks are a single turn of blocks.
+    auto offset = size_t(0);
+    if(!read_blocks(bytes, &offset, &m_initial_blocks) ||
+       offset != bytes.size())
+    {
+        return fail();
+    }
+
+    return true;
+}
+
+bool
+GameRecordReader::read_chunk() noexcept
+{
+    auto chunk = GameRecord::Chunk();
+    if(!read(&chunk, sizeof(chunk)))
+        return false;
+
+    if(chunk.moves_count == 0)
+    {
+        if(chunk.blocks_size != 0)
+            return fail();
+
+        read_footer();
+        return false;
+    }
+
+    auto cells_count = u64(m_header.width) * m_header.height;
+    auto is_seed     = (m_header.spawns == GameRecord::Spawns::Seed);
+    auto max_size    = cells_count * k_max_block_size * chunk.moves_count;
+
+    if(chunk.moves_count > GameRecord::k_chunk_moves ||
+       (is_seed && chunk.blocks_size != 0)           ||
+       chunk.blocks_size > max_size)
+    {
+        return fail();
+    }
+
+    m_moves .resize(GameRecord::get_moves_size(chunk.moves_count));
+    m_blocks.resize(chunk.blocks_size);
+
+    if(!read(m_moves .data(), m_moves .size()) ||
+       !read(m_blocks.data(), m_blocks.size()))
+    {
+        return false;
+    }
+
+    m_chunk_moves_count = chunk.moves_count;
+    m_chunk_move        = 0;
+    m_blocks_offset     = 0;
+
+    return true;
+}
+
+bool
+GameRecordReader::read_footer() noexcept
+{
+    //--------------------------------------------------------------------------
+    // The checksum doesn't cover itself.
+    auto p_footer = reinterpret_cast<char*>(&m_footer);
+    if(!mp_stream->read(p_footer, sizeof(m_footer)))
+        return fail();
+
+    m_size += sizeof(m_footer);
+
+    auto checksum = GameRecord::update_checksum(
+        m_checksum, &m_footer, offsetof(GameRecord::Footer, checksum)
+    );
+
+    auto blocks_count = m_footer.blocks_count;
+    auto moves_count  = m_footer.moves_count;
+    auto is_valid     = m_footer.checksum == checksum
+        && moves_count == m_moves_count
+        && (m_header.spawns == GameRecord::Spawns::Cells
+            || blocks_count == moves_count
+            || blocks_count + 1 == moves_count);
+
+    if(!is_valid)
+        return fail();
+
+    m_complete = true;
+    return true;
+}
+
+bool
+GameRecordReader::read_blocks(
+    const std::vector<u8>          &bytes,
+    size_t                         *p_offset,
+    std::vector<GameRecord::Block> *p_blocks) noexcept
+{
+    auto cells_count = m_header.width * m_header.height;
+
+    p_blocks->clear();
+    while(true)
+    {
+        auto entry = u64(0);
+        auto size  = GameRecord::read_varint(
+            bytes.data() + *p_offset, bytes.size() - *p_offset, &entry
+        );
+        if(size == 0)
+            return fail();
+
+        *p_offset += size;
+
+        auto has_next   = (entry & 1) != 0;
+        auto exponent   = u32(entry >> 1) & 0xF;
+        auto cell_index = entry >> 5;
+
+        //----------------------------------------------------------------------
+        // A turn without blocks.
+        if(exponent == 0)
+            return (!has_next && p_blocks->empty()) || fail();
+
+        if(cell_index >= cells_count)
+            return fail();
+
+        p_blocks->push_back(GameRecord::Block{
+            u32(cell_index),
+            1u << exponent
+        });
+
+        if(!has_next)
+            return true;
+    }
+}
+
+bool
+GameRecordReader::read(void *p_data, size_t size) noexcept
+{
+    if(!mp_stream->read(static_cast<char*>(p_data), size))
+        return fail();
+
+    m_checksum = GameRecord::update_checksum(m_checksum, p_data, size);
+    m_size    += size;
+
+    return true;
+}
+
+bool
+GameRecordReader::fail() noexcept
+{
+    m_valid = false;
+    return false;
+}
@@ -0,0 +1,281 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : GameRecordWriter.cpp                                          //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Streams the turns of a GameCore as a GameRecord.                        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/GameRecordWriter.h"
+// std
+#include <cstddef>
+#include <cstring>
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+GameRecordWriter::GameRecordWriter(
+    std::ostream       *p_stream,
+    GameRecord::Spawns  spawns,
+    u64                 game_id,
+    u32                 values_checksum) noexcept
+    : mp_stream        (p_stream)
+    , m_spawns         (spawns)
+    , m_game_id        (game_id)
+    , m_values_checksum(values_checksum)
+    , mp_game          (nullptr)
+    , m_checksum       (GameRecord::get_empty_checksum())
+    , m_chunk_moves_count(0)
+    , m_last_block_offset(0)
+    , m_moves_count      (0)
+    , m_blocks_count     (0)
+    , m_turn_blocks_count(0)
+{
+    // Empty.
+}
+
+GameRecordWriter::~GameRecordWriter() noexcept
+{
+    if(is_recording())
+        end();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+void
+GameRecordWriter::begin(GameCore *p_game) noexcept
+{
+    COREASSERT_ASSERT(!is_recording(), "The writer is already recording.");
+    COREASSERT_ASSERT(
+        p_game->get_moves_count() == 0 && !p_game->get_record_writer(),
+        "Only new games without writers can be recorded."
+    );
+
+    mp_game = p_game;
+    mp_game->m_record_writer.p_writer = this;
+
+    m_checksum          = GameRecord::get_empty_checksum();
+    m_chunk_moves_count = 0;
+    m_moves_count       = 0;
+    m_blocks_count      = 0;
+    m_turn_blocks_count = 0;
+
+    //--------------------------------------------------------------------------
+    // A chunk of moves with a block each fits, so turns don't allocate.
+    m_moves .clear();
+    m_blocks.clear();
+    m_moves .reserve(GameRecord::get_moves_size(GameRecord::k_chunk_moves));
+    m_blocks.reserve(GameRecord::k_chunk_moves * 2);
+
+    //--------------------------------------------------------------------------
+    // The header is written on the first move, so the blocks generated
+    // before it are initial blocks too. Seed records keep them as well,
+    // to know how many blocks to generate and to check them.
+    auto cell_index = 0u;
+    mp_game->for_each_coord([&](const acow::math::Coord &coord) {
+        auto p_block = mp_game->get_block_at(coord);
+        if(p_block)
+        {
+            write_block(cell_index, p_block->get_value());
+            ++m_turn_blocks_count;
+        }
+
+        ++cell_index;
+    });
+}
+
+bool
+GameRecordWriter::end() noexcept
+{
+    COREASSERT_ASSERT(is_recording(), "The writer isn't recording.");
+
+    if(m_moves_count == 0)
+    {
+        write_header();
+    }
+    else
+    {
+        end_turn   ();
+        flush_chunk();
+    }
+
+    auto end_chunk = GameRecord::Chunk{0, 0};
+    write(&end_chunk, sizeof(end_chunk));
+
+    auto footer = GameRecord::Footer();
+    footer.moves_count  = m_moves_count;
+    footer.blocks_count = m_blocks_count;
+    footer.score        = mp_game->get_score    ();
+    footer.max_value    = mp_game->get_max_value();
+    footer.hash         = mp_game->get_hash     ();
+    footer.status       = u32(mp_game->get_status());
+    footer.checksum     = GameRecord::update_checksum(
+        m_checksum, &footer, offsetof(GameRecord::Footer, checksum)
+    );
+    mp_stream->write(reinterpret_cast<const char*>(&footer), sizeof(footer));
+
+    mp_game->m_record_writer.p_writer = nullptr;
+    mp_game = nullptr;
+
+    mp_stream->flush();
+    return bool(*mp_stream);
+}
+
+
+//----------------------------------------------------------------------------//
+// GameCore Hooks                                                             //
+//----------------------------------------------------------------------------//
+void
+GameRecordWriter::on_move(GameCore::Direction direction) noexcept
+{
+    COREASSERT_ASSERT(
+        m_spawns != GameRecord::Spawns::Seed
+        || m_moves_count == 0 || m_turn_blocks_count == 1,
+        "Seed records need a block after each move but the last."
+    );
+
+    if(m_moves_count == 0)
+        write_header();
+    else
+        end_turn();
+
+    if(m_chunk_moves_count == GameRecord::k_chunk_moves)
+        flush_chunk();
+
+    //--------------------------------------------------------------------------
+    // 4 moves by byte, the first on the low bits.
+    auto shift = (m_chunk_moves_count % 4) * 2;
+    if(shift == 0)
+        m_moves.push_back(0);
+
+    m_moves.back() |= u8(u32(direction) << shift);
+
+    ++m_chunk_moves_count;
+    ++m_moves_count;
+    m_turn_blocks_count = 0;
+}
+
+void
+GameRecordWriter::on_block(u32 cell_index, u32 value) noexcept
+{
+    if(m_moves_count == 0 || m_spawns == GameRecord::Spawns::Cells)
+    {
+        write_block(cell_index, value);
+    }
+    else
+    {
+        COREASSERT_ASSERT(
+            m_turn_blocks_count == 0,
+            "Seed records only have a block after each move."
+        );
+    }
+
+    if(m_moves_count != 0)
+        ++m_blocks_count;
+
+    ++m_turn_blocks_count;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+GameRecordWriter::write_header() noexcept
+{
+    auto header = GameRecord::Header();
+    memcpy(header.magic, GameRecord::get_magic(), sizeof(header.magic));
+    header.version             = GameRecord::k_version;
+    header.spawns              = m_spawns;
+    header.random              = GameRecord::k_random;
+    header.width               = mp_game->get_width ();
+    header.height              = mp_game->get_height();
+    header.seed                = mp_game->get_seed();
+    header.game_id             = m_game_id;
+    header.values_checksum     = m_values_checksum;
+    header.initial_blocks_size = u32(m_blocks.size());
+
+    write(&header, sizeof(header));
+    write(m_blocks.data(), m_blocks.size());
+
+    m_blocks.clear();
+}
+
+void
+GameRecordWriter::write_block(u32 cell_index, u32 value) noexcept
+{
+    auto exponent = u32(__builtin_ctz(value));
+    COREASSERT_ASSERT(
+        exponent <= GameRecord::k_max_exponent,
+        "Block (%u) is too big to be recorded.",
+        value
+    );
+
+    // The previous block of the turn is told that this one follows.
+    if(m_turn_blocks_count != 0)
+        m_blocks[m_last_block_offset] |= 1;
+
+    u8 bytes[10];
+    auto entry = (u64(cell_index) << 4 | exponent) << 1;
+    auto size  = GameRecord::write_varint(entry, bytes);
+
+    m_last_block_offset = m_blocks.size();
+    m_blocks.insert(m_blocks.end(), bytes, bytes + size);
+}
+
+void
+GameRecordWriter::end_turn() noexcept
+{
+    // Cells records mark the turns without blocks.
+    if(m_spawns == GameRecord::Spawns::Cells && m_turn_blocks_count == 0)
+        m_blocks.push_back(0);
+}
+
+void
+GameRecordWriter::flush_chunk() noexcept
+{
+    if(m_chunk_moves_count == 0)
+        return;
+
+    auto chunk = GameRecord::Chunk{
+        m_chunk_moves_count,
+        u32(m_blocks.size())
+    };
+
+    write(&chunk,          sizeof(chunk) );
+    write(m_moves .data(), m_moves .size());
+    write(m_blocks.data(), m_blocks.size());
+
+    m_moves .clear();
+    m_blocks.clear();
+    m_chunk_moves_count = 0;
+}
+
+void
+GameRecordWriter::write(const void *p_data, size_t size) noexcept
+{
+    m_checksum = GameRecord::update_checksum(m_checksum, p_data, size);
+    mp_stream->write(static_cast<const char*>(p_data), size);
+}
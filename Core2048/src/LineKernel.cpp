@@ -0,0 +1,375 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineKernel.cpp                                                //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/LineKernel.h"
+// std
+#include <cstring>
+#include <vector>
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+
+// The SIMD versions are compiled for their own targets, so the
+// library itself doesn't need to be built with any special flag.
+#if defined(__x86_64__) || defined(__i386__)
+    #define CORE2048_LINE_KERNEL_X86 1
+    #include <immintrin.h>
+#else
+    #define CORE2048_LINE_KERNEL_X86 0
+#endif
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_line_size   = LineKernel::k_max_line_size;
+constexpr auto k_chunk_size  = 8u; // Cells compacted by a single shuffle.
+constexpr auto k_buffer_size = k_line_size + 16; // Room for the last loads.
+
+constexpr auto k_even_bits = 0x5555555555555555ULL;
+constexpr auto k_odd_bits  = 0xAAAAAAAAAAAAAAAAULL;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+inline u64
+get_low_bits(u32 count) noexcept
+{
+    return (count >= 64) ? ~u64(0) : ((u64(1) << count) -1);
+}
+
+// Takes the bits of the adjacent equal cells and gives the first cell of
+// each pair that merges. A run of equal cells merges in pairs from its
+// start, so the pairs are the bits at even distance of the run start.
+u64
+get_merge_pairs(u64 equal_mask) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Adding the start bit of a run carries through the whole run,
+    // clearing it, so the cleared bits are the runs that start at odd bits.
+    auto starts     = equal_mask & ~(equal_mask << 1);
+    auto odd_starts = starts & k_odd_bits;
+    auto odd_runs   = equal_mask & ~(equal_mask + odd_starts);
+
+    return (odd_runs  & k_odd_bits)
+         | (equal_mask & ~odd_runs & k_even_bits);
+}
+
+// Compacted line is merged and the cells are put on their targets.
+void
+finish_line_kernel(
+    const u8                *p_cells,
+    const u8                *p_sources,
+    u32                      count,
+    u64                      equal_mask,
+    LineKernel::Transition  *p_transition) noexcept
+{
+    std::memset(p_transition->line, 0, k_line_size);
+    p_transition->moved_mask   = 0;
+    p_transition->merged_mask  = 0;
+    p_transition->removed_mask = 0;
+
+    auto pairs        = get_merge_pairs(equal_mask & get_low_bits(count -1));
+    auto removed      = pairs << 1;
+    auto merges_count = 0u;
+
+    for(auto i = 0u; i < count; ++i)
+    {
+        auto source = p_sources[i];
+        auto mask   = u64(1) << source;
+
+        //----------------------------------------------------------------------
+        // Each merge before this cell takes one cell of the line.
+        auto target = i - merges_count;
+        p_transition->targets[source] = u8(target);
+
+        if((removed >> i) & 1)
+        {
+            p_transition->removed_mask |= mask;
+            continue;
+        }
+
+        if((pairs >> i) & 1)
+        {
+            p_transition->line[target]  = p_cells[i] + 1;
+            p_transition->merged_mask  |= mask;
+            ++merges_count;
+        }
+        else
+        {
+            p_transition->line[target] = p_cells[i];
+        }
+
+        if(target != source)
+            p_transition->moved_mask |= mask;
+    }
+}
+
+
+//------------------------------------------------------------------------------
+// Scalar
+void
+move_line_kernel_scalar(
+    const u8               *p_line,
+    LineKernel::Transition *p_transition) noexcept
+{
+    u8   cells  [k_buffer_size];
+    u8   sources[k_buffer_size];
+    auto count = 0u;
+
+    for(auto i = 0u; i < k_line_size; ++i)
+    {
+        if(p_line[i] == 0)
+            continue;
+
+        cells  [count] = p_line[i];
+        sources[count] = u8(i);
+        ++count;
+    }
+
+    auto equal_mask = u64(0);
+    for(auto i = 1u; i < count; ++i)
+    {
+        if(cells[i -1] == cells[i])
+            equal_mask |= u64(1) << (i -1);
+    }
+
+    finish_line_kernel(cells, sources, count, equal_mask, p_transition);
+}
+
+#if CORE2048_LINE_KERNEL_X86
+//------------------------------------------------------------------------------
+// SSE4.1
+// Shuffles that move the non empty cells of a chunk to its start,
+// one for each mask of non empty cells.
+const u64*
+get_compact_shuffles() noexcept
+{
+    // Function statics are initialized only once, even with threads.
+    static const std::vector<u64> s_shuffles = []() {
+        auto shuffles = std::vector<u64>(1 << k_chunk_size);
+        for(auto mask = 0u; mask < shuffles.size(); ++mask)
+        {
+            auto shuffle = ~u64(0); // 0xFF makes the byte 0.
+            auto count   = 0u;
+            for(auto i = 0u; i < k_chunk_size; ++i)
+            {
+                if(!(mask & (1u << i)))
+                    continue;
+
+                shuffle &= ~(u64(0xFF) << (count * 8));
+                shuffle |=  (u64(i)    << (count * 8));
+                ++count;
+            }
+
+            shuffles[mask] = shuffle;
+        }
+
+        return shuffles;
+    }();
+
+    return s_shuffles.data();
+}
+
+// Both kernels inline these, the AVX2 one gets them VEX encoded to not
+// mix AVX and SSE instructions. There's no byte compaction on AVX2,
+// so it's done by the same shuffles of SSE4.1.
+__attribute__((target("sse4.1"), always_inline))
+inline u32
+compact_line(
+    const u8 *p_line,
+    u64       nonzero_mask,
+    u8       *p_cells,
+    u8       *p_sources) noexcept
+{
+    auto p_shuffles = get_compact_shuffles();
+    auto indexes    = _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7,
+                                    0, 0, 0, 0, 0, 0, 0, 0);
+    auto count      = 0u;
+
+    for(auto chunk = 0u; chunk < k_line_size; chunk += k_chunk_size)
+    {
+        auto mask    = u32((nonzero_mask >> chunk) & 0xFF);
+        auto shuffle = _mm_loadl_epi64((const __m128i*)&p_shuffles[mask]);
+        auto cells   = _mm_loadl_epi64((const __m128i*)(p_line + chunk));
+        auto sources = _mm_add_epi8(indexes, _mm_set1_epi8(char(chunk)));
+
+        _mm_storel_epi64(
+            (__m128i*)(p_cells + count),
+            _mm_shuffle_epi8(cells, shuffle)
+        );
+        _mm_storel_epi64(
+            (__m128i*)(p_sources + count),
+            _mm_shuffle_epi8(sources, shuffle)
+        );
+
+        count += u32(__builtin_popcount(mask));
+    }
+
+    return count;
+}
+
+// The compacted cells were just stored 8 at a time, loads wider than
+// 16 bytes can't be forwarded from those stores and stall, so AVX2
+// compares them 16 at a time too.
+__attribute__((target("sse4.1"), always_inline))
+inline u64
+get_equal_mask(const u8 *p_cells, u32 count) noexcept
+{
+    auto equal_mask = u64(0);
+    for(auto i = 0u; i < count; i += 16)
+    {
+        auto curr  = _mm_loadu_si128((const __m128i*)(p_cells + i));
+        auto next  = _mm_loadu_si128((const __m128i*)(p_cells + i + 1));
+        auto equal = u32(_mm_movemask_epi8(_mm_cmpeq_epi8(curr, next)));
+
+        equal_mask |= u64(equal & 0xFFFF) << i;
+    }
+
+    return equal_mask;
+}
+
+__attribute__((target("sse4.1")))
+void
+move_line_kernel_sse41(
+    const u8               *p_line,
+    LineKernel::Transition *p_transition) noexcept
+{
+    u8 cells  [k_buffer_size];
+    u8 sources[k_buffer_size];
+
+    auto zero         = _mm_setzero_si128();
+    auto nonzero_mask = u64(0);
+    for(auto i = 0u; i < k_line_size; i += 16)
+    {
+        auto line  = _mm_loadu_si128((const __m128i*)(p_line + i));
+        auto empty = u32(_mm_movemask_epi8(_mm_cmpeq_epi8(line, zero)));
+
+        nonzero_mask |= u64(~empty & 0xFFFF) << i;
+    }
+
+    auto count      = compact_line(p_line, nonzero_mask, cells, sources);
+    auto equal_mask = get_equal_mask(cells, count);
+
+    finish_line_kernel(cells, sources, count, equal_mask, p_transition);
+}
+
+//------------------------------------------------------------------------------
+// AVX2
+__attribute__((target("avx2")))
+void
+move_line_kernel_avx2(
+    const u8               *p_line,
+    LineKernel::Transition *p_transition) noexcept
+{
+    u8 cells  [k_buffer_size];
+    u8 sources[k_buffer_size];
+
+    auto zero         = _mm256_setzero_si256();
+    auto nonzero_mask = u64(0);
+    for(auto i = 0u; i < k_line_size; i += 32)
+    {
+        auto line  = _mm256_loadu_si256((const __m256i*)(p_line + i));
+        auto empty = u32(_mm256_movemask_epi8(_mm256_cmpeq_epi8(line, zero)));
+
+        nonzero_mask |= u64(~empty) << i;
+    }
+
+    auto count      = compact_line(p_line, nonzero_mask, cells, sources);
+    auto equal_mask = get_equal_mask(cells, count);
+
+    finish_line_kernel(cells, sources, count, equal_mask, p_transition);
+}
+#endif // CORE2048_LINE_KERNEL_X86
+
+LineKernel::Isa
+detect_line_kernel_isa() noexcept
+{
+#if CORE2048_LINE_KERNEL_X86
+    __builtin_cpu_init();
+
+    if(__builtin_cpu_supports("avx2"))
+        return LineKernel::Isa::AVX2;
+    if(__builtin_cpu_supports("sse4.1"))
+        return LineKernel::Isa::SSE41;
+#endif // CORE2048_LINE_KERNEL_X86
+
+    return LineKernel::Isa::Scalar;
+}
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+void
+LineKernel::move_line(
+    const u8   *p_line,
+    Transition *p_transition) noexcept
+{
+    move_line(get_isa(), p_line, p_transition);
+}
+
+void
+LineKernel::move_line(
+    Isa         isa,
+    const u8   *p_line,
+    Transition *p_transition) noexcept
+{
+    COREASSERT_ASSERT(
+        is_isa_supported(isa),
+        "Isa (%d) is not supported by this CPU",
+        int(isa)
+    );
+
+    switch(isa)
+    {
+#if CORE2048_LINE_KERNEL_X86
+        case Isa::AVX2  : move_line_kernel_avx2  (p_line, p_transition); break;
+        case Isa::SSE41 : move_line_kernel_sse41 (p_line, p_transition); break;
+#endif // CORE2048_LINE_KERNEL_X86
+        default         : move_line_kernel_scalar(p_line, p_transition); break;
+    }
+}
+
+//
+LineKernel::Isa
+LineKernel::get_isa() noexcept
+{
+    // Function statics are initialized only once, even with threads.
+    static const auto s_isa = detect_line_kernel_isa();
+    return s_isa;
+}
+
+bool
+LineKernel::is_isa_supported(Isa isa) noexcept
+{
+    switch(isa)
+    {
+        case Isa::Scalar : return true;
+        case Isa::SSE41  : return get_isa() != Isa::Scalar;
+        case Isa::AVX2   : return get_isa() == Isa::AVX2;
+    }
+
+    return false;
+}
@@ -0,0 +1,115 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : LineTable.cpp                                                 //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/LineTable.h"
+// std
+#include <vector>
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+LineTable::Transition
+LineTable::compute_transition(u16 line) noexcept
+{
+    auto transition = Transition();
+    transition.score        = 0;
+    transition.line         = 0;
+    transition.moved_mask   = 0;
+    transition.merged_mask  = 0;
+    transition.removed_mask = 0;
+    transition.targets      = 0;
+
+    u32  exponents[k_line_size] = {0};
+    u32  sources  [k_line_size] = {0}; // Which cell each result came from.
+    bool merged   [k_line_size] = {false};
+    auto count                  = 0u;
+
+    for(auto i = 0u; i < k_line_size; ++i)
+    {
+        auto exponent = u32((line >> (i * 4)) & 0xF);
+
+        //----------------------------------------------------------------------
+        // Empty cell.
+        if(exponent == 0)
+            continue;
+
+        //----------------------------------------------------------------------
+        // Same value of the previous block that wasn't merged yet
+        // (and isn't too big to be merged), so merge them.
+        if(count != 0                      &&
+           exponents[count -1] == exponent &&
+           !merged[count -1]               &&
+           exponent < k_max_exponent)
+        {
+            auto target = count -1;
+
+            ++exponents[target];
+            merged[target] = true;
+
+            transition.score        += (1u << exponents[target]);
+            transition.merged_mask  |= (1u << sources[target]);
+            transition.removed_mask |= (1u << i);
+            transition.targets      |= (target << (i * 2));
+        }
+        //----------------------------------------------------------------------
+        // Just slide it.
+        else
+        {
+            auto target = count++;
+
+            exponents[target] = exponent;
+            sources  [target] = i;
+
+            if(target != i)
+                transition.moved_mask |= (1u << i);
+
+            transition.targets |= (target << (i * 2));
+        }
+    }
+
+    for(auto i = 0u; i < count; ++i)
+        transition.line |= u16(exponents[i] << (i * 4));
+
+    return transition;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+const LineTable::Transition*
+LineTable::get_table() noexcept
+{
+    // Function statics are initialized only once, even with threads.
+    static const std::vector<Transition> s_table = []() {
+        auto table = std::vector<Transition>(k_entries_count);
+        for(auto i = 0u; i < k_entries_count; ++i)
+            table[i] = compute_transition(u16(i));
+
+        return table;
+    }();
+
+    return s_table.data();
+}
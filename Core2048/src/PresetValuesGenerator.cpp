@@ -20,9 +20,6 @@
 
 // Header
 #include "../include/PresetValuesGenerator.h"
-// std
-#include <fstream>
-#include <sstream>
 // AmazingCow Libs.
 #include "CoreAssert/CoreAssert.h"
 #include "CoreGame/CoreGame.h"
@@ -37,54 +34,19 @@ USING_NS_CORE2048;
 //----------------------------------------------------------------------------//
 PresetValuesGenerator::PresetValuesGenerator(
     const std::string &filename) noexcept
+    : PresetValuesGenerator(ValuesTable::load(filename))
 {
-    //Open File.
-    std::ifstream in_stream;
-    in_stream.open(filename);
-
-    COREASSERT_ASSERT(
-        in_stream.is_open(),
-        "Cannot open file: (%s)",
-        filename.c_str()
-    );
-
-    // Parse File.
-    // Data is this format:
-    //    Max Curr Value | GenMax (chance percent)
-    //    int() char('|') int() char('(') (int) char(')')
-    // Lines starting with # are ignored.
-    // Whitespace are ignored.
-    while(!in_stream.eof())
-    {
-        std::string line;
-        std::getline(in_stream, line);
-
-        // Comments - Ignore.
-        if(line.size() != 0 && line[0] == '#')
-            continue;
-
-        u32 MaxCurrValue, GenMax, ChangePercent;
-        u8  dummy;
-
-        std::stringstream ss(line);
-        ss >> MaxCurrValue >> dummy;
-
-
-        std::vector<std::pair<u32, u32>> gen_percent_vec;
-        while(!ss.eof())
-        {
-            std::string gen_per_token;
-            ss >> gen_per_token;
-
-            sscanf(gen_per_token.c_str(), "%d(%d)", &GenMax, &ChangePercent);
-
-            gen_percent_vec.push_back(
-                std::make_pair(GenMax, ChangePercent)
-            );
-        }
+    // Empty...
+}
 
-        m_values_matrix[MaxCurrValue] = gen_percent_vec;
-    }
+PresetValuesGenerator::PresetValuesGenerator(
+    std::shared_ptr<const ValuesTable> p_table) noexcept
+    : m_max_value (0)
+    , mp_table    (std::move(p_table))
+    , mp_row      (nullptr)
+    , mp_entries  (nullptr)
+{
+    COREASSERT_ASSERT(mp_table != nullptr, "The values table is null.");
 }
 
 
@@ -92,38 +54,15 @@ PresetValuesGenerator::PresetValuesGenerator(
 // IValuesGenerator Interface                                                 //
 //----------------------------------------------------------------------------//
 u32
-PresetValuesGenerator::generate_value(CoreRandom::Random &rnd_gen) noexcept
+PresetValuesGenerator::generate_value(Random &rnd_gen) noexcept
 {
     COREASSERT_ASSERT(
-        (m_max_value >= 2),
-        "m_max_value(%d) must be >= 2.",
-        m_max_value
-    );
-
-    COREASSERT_ASSERT(
-        m_values_matrix.find(m_max_value) != m_values_matrix.end(),
+        mp_row != nullptr,
         "m_max_value(%d) don't exists... check your input data.",
         m_max_value
     );
 
-    auto &gen_per_vec = m_values_matrix[m_max_value];
-    auto rnd_value    = rnd_gen.next(0, 100);
-
-    // The random value generated is in range of (0,100)
-    // and the data is in format of ValueToBeGenerated - Percentage
-    // So we sum the previous percentages to make the random value
-    // in map to the percentage.
-    auto sum = 0;
-    for(int i = 0; i < gen_per_vec.size(); ++i)
-    {
-        sum += gen_per_vec[i].second;
-
-        if(rnd_value <= sum)
-            return gen_per_vec[i].first;
-    }
-
-    COREASSERT_ASSERT(false, "Cannot be here...");
-    return 0; // Makes compiler happy...
+    return ValuesTable::draw_value(mp_entries, mp_row->entries_count, rnd_gen);
 }
 
 void
@@ -136,4 +75,37 @@ PresetValuesGenerator::set_max_value(u32 value) noexcept
     );
 
     m_max_value = value;
+    mp_row      = nullptr;
+
+    //--------------------------------------------------------------------------
+    // Max values past the last row of the table keep drawing from it.
+    for(auto row_value = value; row_value >= 2 && !mp_row; row_value >>= 1)
+        mp_row = mp_table->get_row(row_value);
+
+    mp_entries = (mp_row) ? mp_table->get_entries(mp_row) : nullptr;
+}
+
+u32
+PresetValuesGenerator::get_max_value() const noexcept
+{
+    return m_max_value;
+}
+
+IValuesGenerator::ValuesChances
+PresetValuesGenerator::get_values_chances() const noexcept
+{
+    COREASSERT_ASSERT(
+        mp_row != nullptr,
+        "m_max_value(%d) don't exists... check your input data.",
+        m_max_value
+    );
+
+    auto chances = ValuesChances();
+    for(auto i = 0u; i < mp_row->entries_count; ++i)
+    {
+        auto &entry = mp_entries[i];
+        chances.push_back(std::make_pair(entry.value, entry.chance));
+    }
+
+    return chances;
 }
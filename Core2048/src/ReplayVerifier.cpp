@@ -0,0 +1,318 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ReplayVerifier.cpp                                            //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Verifies the scores of played games by replaying them.                  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/ReplayVerifier.h"
+// std
+#include <algorithm>
+#include <chrono>
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+// Core2048
+#include "../include/BitBoardGameCore.h"
+#include "../include/PresetValuesGenerator.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Same as the biggest board that can be journaled.
+constexpr auto k_max_cells_count = u64(1) << 24;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+inline bool
+replay_move(BitBoardGameCore &core, GameCore::Direction direction) noexcept
+{
+    return core.make_move(direction);
+}
+
+inline bool
+replay_move(GameCore &core, GameCore::Direction direction) noexcept
+{
+    return core.make_move(direction).move_valid;
+}
+
+inline u32
+count_empty_cells(const BitBoardGameCore &core) noexcept
+{
+    return core.get_board().count_empty();
+}
+
+inline u32
+count_empty_cells(const GameCore &core) noexcept
+{
+    return core.get_empty_cells_count();
+}
+
+// The same turns on both cores, a block after each valid move.
+template <typename Core>
+ReplayVerifier::Result
+replay_game(Core &core, const ReplayVerifier::Game &game) noexcept
+{
+    typedef ReplayVerifier::Verdict Verdict;
+
+    auto result = ReplayVerifier::Result{Verdict::Valid, 0, 0};
+
+    //--------------------------------------------------------------------------
+    // The core already generated the first block.
+    for(auto i = 1u; i < game.initial_blocks_count; ++i)
+    {
+        if(count_empty_cells(core) == 0)
+            return ReplayVerifier::Result{Verdict::Malformed, 0, 0};
+
+        core.generate_next_block();
+    }
+
+    //--------------------------------------------------------------------------
+    // Valid moves always leave an empty cell, moves on a full board
+    // must merge something.
+    for(auto i = 0u; i < game.moves_count; ++i)
+    {
+        auto direction = GameCore::Direction(
+            (game.moves[i / 4] >> ((i % 4) * 2)) & 3
+        );
+
+        if(!replay_move(core, direction))
+        {
+            result.verdict = Verdict::IllegalMove;
+            break;
+        }
+
+        ++result.moves_count;
+        if(i < game.blocks_count)
+            core.generate_next_block();
+    }
+
+    result.score = core.get_score();
+    if(result.verdict == Verdict::Valid && result.score != game.claimed_score)
+        result.verdict = Verdict::ScoreMismatch;
+
+    return result;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+ReplayVerifier::ReplayVerifier(const GeneratorFactory &factory) noexcept
+    : mp_pool         (nullptr)
+    , m_factory       (factory)
+    , m_total_counters()
+{
+    COREASSERT_ASSERT(factory, "factory cannot be empty");
+}
+
+ReplayVerifier::ReplayVerifier(std::shared_ptr<const ValuesTable> p_table)
+    noexcept
+    : ReplayVerifier([p_table]() {
+        return std::shared_ptr<IValuesGenerator>(
+            std::make_shared<PresetValuesGenerator>(p_table)
+        );
+    })
+{
+    // Empty.
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+ReplayVerifier::Counters
+ReplayVerifier::verify(
+    const std::vector<Game> &games,
+    std::vector<Result>     *p_results) noexcept
+{
+    auto start = std::chrono::steady_clock::now();
+
+    auto games_count = u32(games.size());
+    p_results->resize(games_count);
+
+    //--------------------------------------------------------------------------
+    // Each batch writes the results on its own range, so no locks.
+    auto batches_count = (games_count + k_batch_size -1) / k_batch_size;
+    for(auto batch = 0u; batch < batches_count; ++batch)
+    {
+        auto first_game  = batch * k_batch_size;
+        auto batch_games = std::min(
+            u32(k_batch_size),
+            games_count - first_game
+        );
+        auto p_batch_games   = games.data()      + first_game;
+        auto p_batch_results = p_results->data() + first_game;
+
+        if(!mp_pool)
+        {
+            auto p_generator = m_factory();
+            verify_batch(
+                p_batch_games, batch_games, p_batch_results, p_generator.get()
+            );
+            continue;
+        }
+
+        mp_pool->submit([=]() {
+            auto p_generator = m_factory();
+            verify_batch(
+                p_batch_games, batch_games, p_batch_results, p_generator.get()
+            );
+        });
+    }
+
+    if(mp_pool)
+        mp_pool->wait();
+
+    //--------------------------------------------------------------------------
+    // Gather the counters.
+    auto counters = Counters();
+    counters.games_count = games_count;
+
+    for(const auto &result : *p_results)
+    {
+        counters.moves_count += result.moves_count;
+        ++counters.verdicts_counts[u32(result.verdict)];
+    }
+
+    counters.seconds = std::chrono::duration<f64>(
+        std::chrono::steady_clock::now() - start
+    ).count();
+
+    //--------------------------------------------------------------------------
+    // Totals.
+    m_total_counters.games_count += counters.games_count;
+    m_total_counters.moves_count += counters.moves_count;
+    m_total_counters.seconds     += counters.seconds;
+    for(auto i = 0u; i < 4; ++i)
+    {
+        m_total_counters.verdicts_counts[i] += counters.verdicts_counts[i];
+    }
+
+    for(auto p_counters : { &counters, &m_total_counters })
+    {
+        auto seconds = std::max(p_counters->seconds, 1e-9);
+        p_counters->games_per_second = p_counters->games_count / seconds;
+        p_counters->moves_per_second = p_counters->moves_count / seconds;
+    }
+
+    return counters;
+}
+
+ReplayVerifier::Result
+ReplayVerifier::verify_game(const Game &game) noexcept
+{
+    auto p_generator = m_factory();
+    return verify_game(game, p_generator.get(), nullptr);
+}
+
+//
+bool
+ReplayVerifier::read_game(GameRecordReader *p_reader, Game *p_game) noexcept
+{
+    const auto &header = p_reader->get_header();
+    if(!p_reader->is_valid() || header.spawns != GameRecord::Spawns::Seed)
+        return false;
+
+    p_game->seed                 = i32(header.seed);
+    p_game->width                = header.width;
+    p_game->height               = header.height;
+    p_game->initial_blocks_count = u32(p_reader->get_initial_blocks().size());
+    p_game->moves_count          = 0;
+    p_game->moves.clear();
+
+    auto turn = GameRecordReader::Turn();
+    while(p_reader->read_turn(&turn))
+    {
+        auto shift = (p_game->moves_count % 4) * 2;
+        if(shift == 0)
+            p_game->moves.push_back(0);
+
+        p_game->moves.back() |= u8(u32(turn.direction) << shift);
+        ++p_game->moves_count;
+    }
+
+    if(!p_reader->is_complete())
+        return false;
+
+    p_game->blocks_count  = p_reader->get_footer().blocks_count;
+    p_game->claimed_score = p_reader->get_footer().score;
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+ReplayVerifier::verify_batch(
+    const Game       *p_games,
+    u32               games_count,
+    Result           *p_results,
+    IValuesGenerator *p_generator) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // The games of the batch are replayed one after the other,
+    // so they all reuse the same memory of the arena.
+    Arena arena;
+    for(auto i = 0u; i < games_count; ++i)
+        p_results[i] = verify_game(p_games[i], p_generator, &arena);
+}
+
+ReplayVerifier::Result
+ReplayVerifier::verify_game(
+    const Game       &game,
+    IValuesGenerator *p_generator,
+    Arena            *p_arena) const noexcept
+{
+    auto cells_count = u64(game.width) * game.height;
+    auto is_valid    = cells_count != 0
+        && cells_count <= k_max_cells_count
+        && game.initial_blocks_count != 0
+        && game.initial_blocks_count <= cells_count
+        && game.moves.size() >= GameRecord::get_moves_size(game.moves_count)
+        && (game.blocks_count == game.moves_count ||
+            game.blocks_count + 1 == game.moves_count);
+
+    if(!is_valid)
+        return Result{Verdict::Malformed, 0, 0};
+
+    //--------------------------------------------------------------------------
+    // Same rules and same random numbers, without the blocks.
+    //   The BitBoard can't merge two 32768, games that made one might
+    //   have merged them, so those are replayed again on a GameCore.
+    if(game.width == BitBoard::k_size && game.height == BitBoard::k_size)
+    {
+        auto core   = BitBoardGameCore(p_generator, game.seed);
+        auto result = replay_game(core, game);
+
+        if(core.get_max_value() < (1u << BitBoard::k_max_exponent))
+            return result;
+    }
+
+    auto core = GameCore(
+        p_generator, game.width, game.height, game.seed, p_arena
+    );
+    return replay_game(core, game);
+}
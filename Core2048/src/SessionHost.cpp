@@ -0,0 +1,255 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : SessionHost.cpp                                               //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Hosts the games of many players at once.                                //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/SessionHost.h"
+// std
+#include <tuple>   //forward_as_tuple
+#include <utility> //piecewise_construct
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+// Core2048
+#include "../include/PresetValuesGenerator.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+SessionHost::Shard::Shard(std::shared_ptr<IValuesGenerator> p_values_generator)
+    noexcept
+    : mutex      ()
+    , arena      ()
+    , p_generator(std::move(p_values_generator))
+    , sessions   (Sessions::allocator_type(&arena))
+{
+    // Empty...
+}
+
+SessionHost::SessionHost(const GeneratorFactory &factory, u32 shards_count)
+    noexcept
+    : mp_pool          (nullptr)
+    , m_shards         ()
+    , m_next_session_id(k_invalid_session_id + 1)
+    , m_sessions_count (0)
+{
+    COREASSERT_ASSERT(factory,           "factory cannot be empty");
+    COREASSERT_ASSERT(shards_count != 0, "shards_count cannot be 0");
+
+    for(auto i = 0u; i < shards_count; ++i)
+        m_shards.push_back(std::unique_ptr<Shard>(new Shard(factory())));
+}
+
+SessionHost::SessionHost(
+    std::shared_ptr<const ValuesTable> p_table,
+    u32                                shards_count) noexcept
+    : SessionHost(
+        [p_table]() {
+            return std::shared_ptr<IValuesGenerator>(
+                std::make_shared<PresetValuesGenerator>(p_table)
+            );
+        },
+        shards_count
+    )
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+SessionHost::SessionId
+SessionHost::create(u32 width, u32 height, i32 seed) noexcept
+{
+    auto  session_id = m_next_session_id++;
+    auto &shard      = get_shard(session_id);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+
+        shard.sessions.emplace(
+            std::piecewise_construct,
+            std::forward_as_tuple(session_id),
+            std::forward_as_tuple(
+                shard.p_generator.get(), width, height, seed, &shard.arena
+            )
+        );
+    }
+
+    ++m_sessions_count;
+    return session_id;
+}
+
+SessionHost::MoveOutcome
+SessionHost::apply_move(
+    SessionId           session_id,
+    GameCore::Direction direction) noexcept
+{
+    auto &shard = get_shard(session_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.sessions.find(session_id);
+    if(it == shard.sessions.end())
+        return MoveOutcome();
+
+    return make_move(shard, it->second, direction);
+}
+
+void
+SessionHost::apply_moves(
+    const std::vector<Move>  &moves,
+    std::vector<MoveOutcome> *p_outcomes) noexcept
+{
+    auto moves_count  = u32(moves.size());
+    auto shards_count = u32(m_shards.size());
+
+    p_outcomes->resize(moves_count);
+
+    //--------------------------------------------------------------------------
+    // Group the moves by shard, in the order they were given.
+    //   The moves of a shard are at indexes[firsts[shard], firsts[shard +1]).
+    auto firsts  = std::vector<u32>(shards_count + 1, 0);
+    auto indexes = std::vector<u32>(moves_count);
+
+    for(const auto &move : moves)
+        ++firsts[get_shard_index(move.session_id) + 1];
+    for(auto shard = 0u; shard < shards_count; ++shard)
+        firsts[shard + 1] += firsts[shard];
+
+    auto nexts = std::vector<u32>(firsts.begin(), firsts.end() -1);
+    for(auto i = 0u; i < moves_count; ++i)
+        indexes[nexts[get_shard_index(moves[i].session_id)]++] = i;
+
+    //--------------------------------------------------------------------------
+    // Each shard writes the outcomes of its own moves, so no other locks.
+    for(auto shard = 0u; shard < shards_count; ++shard)
+    {
+        auto indexes_count = firsts[shard + 1] - firsts[shard];
+        if(indexes_count == 0)
+            continue;
+
+        auto p_shard   = m_shards[shard].get();
+        auto p_moves   = moves.data();
+        auto p_indexes = indexes.data() + firsts[shard];
+        auto p_results = p_outcomes->data();
+
+        if(!mp_pool)
+        {
+            apply_shard_moves(
+                *p_shard, p_moves, p_indexes, indexes_count, p_results
+            );
+            continue;
+        }
+
+        mp_pool->submit_to(shard % mp_pool->get_threads_count(), [=]() {
+            apply_shard_moves(
+                *p_shard, p_moves, p_indexes, indexes_count, p_results
+            );
+        });
+    }
+
+    if(mp_pool)
+        mp_pool->wait();
+}
+
+bool
+SessionHost::snapshot(SessionId session_id, GameCore::Snapshot *p_snapshot)
+    noexcept
+{
+    auto &shard = get_shard(session_id);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    auto it = shard.sessions.find(session_id);
+    if(it == shard.sessions.end())
+        return false;
+
+    *p_snapshot = it->second.snapshot();
+    return true;
+}
+
+bool
+SessionHost::close(SessionId session_id) noexcept
+{
+    auto &shard = get_shard(session_id);
+    {
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if(shard.sessions.erase(session_id) == 0)
+            return false;
+    }
+
+    --m_sessions_count;
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+SessionHost::apply_shard_moves(
+    Shard       &shard,
+    const Move  *p_moves,
+    const u32   *p_indexes,
+    u32          indexes_count,
+    MoveOutcome *p_outcomes) noexcept
+{
+    std::lock_guard<std::mutex> lock(shard.mutex);
+
+    for(auto i = 0u; i < indexes_count; ++i)
+    {
+        auto  index = p_indexes[i];
+        auto &move  = p_moves[index];
+
+        auto it = shard.sessions.find(move.session_id);
+        p_outcomes[index] = (it != shard.sessions.end())
+            ? make_move(shard, it->second, move.direction)
+            : MoveOutcome();
+    }
+}
+
+SessionHost::MoveOutcome
+SessionHost::make_move(
+    Shard               &shard,
+    GameCore            &game,
+    GameCore::Direction  direction) noexcept
+{
+    auto outcome = MoveOutcome();
+    outcome.session_found = true;
+    outcome.move_valid    = game.make_move(direction).move_valid;
+
+    //--------------------------------------------------------------------------
+    // Valid moves always leave an empty cell.
+    //   The generator has the max value of the last game that used it.
+    if(outcome.move_valid)
+    {
+        shard.p_generator->set_max_value(game.get_max_value());
+        game.generate_next_block();
+    }
+
+    outcome.moves_count = game.get_moves_count();
+    outcome.score       = game.get_score();
+    outcome.hash        = game.get_hash();
+    outcome.status      = game.get_status();
+
+    return outcome;
+}
@@ -0,0 +1,477 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Solver.cpp                                                    //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Solver.h"
+// std
+#include <cmath>  //pow
+#include <limits>
+// Core2048
+#include "../include/Zobrist.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_lost_penalty         = 200000.0f;
+constexpr auto k_monotonicity_power   =      4.0f;
+constexpr auto k_monotonicity_weight  =     47.0f;
+constexpr auto k_sum_power            =      3.5f;
+constexpr auto k_sum_weight           =     11.0f;
+constexpr auto k_merges_weight        =    700.0f;
+constexpr auto k_empty_weight         =    270.0f;
+
+constexpr auto k_directions_count     = 4;
+constexpr auto k_time_check_interval  = 1024; // Nodes between clock reads.
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+f32
+evaluate_row(u16 row) noexcept
+{
+    f32 line[BitBoard::k_size];
+    for(auto i = 0u; i < BitBoard::k_size; ++i)
+        line[i] = f32((row >> (i * 4)) & 0xF);
+
+    auto sum    = 0.0f;
+    auto empty  = 0;
+    auto merges = 0;
+
+    //--------------------------------------------------------------------------
+    // Empty cells and blocks that can merge.
+    auto prev    = 0.0f;
+    auto counter = 0;
+    for(auto i = 0u; i < BitBoard::k_size; ++i)
+    {
+        auto rank = line[i];
+        sum += std::pow(rank, k_sum_power);
+
+        if(rank == 0)
+        {
+            ++empty;
+            continue;
+        }
+
+        if(prev == rank)
+        {
+            ++counter;
+        }
+        else if(counter > 0)
+        {
+            merges += 1 + counter;
+            counter = 0;
+        }
+
+        prev = rank;
+    }
+
+    if(counter > 0)
+        merges += 1 + counter;
+
+    //--------------------------------------------------------------------------
+    // Monotonicity, rows should be always increasing or decreasing.
+    auto monotonicity_left  = 0.0f;
+    auto monotonicity_right = 0.0f;
+    for(auto i = 1u; i < BitBoard::k_size; ++i)
+    {
+        auto a = std::pow(line[i -1], k_monotonicity_power);
+        auto b = std::pow(line[i   ], k_monotonicity_power);
+
+        if(line[i -1] > line[i])
+            monotonicity_left  += a - b;
+        else
+            monotonicity_right += b - a;
+    }
+
+    return k_lost_penalty
+         + k_empty_weight  * empty
+         + k_merges_weight * merges
+         - k_monotonicity_weight * acow::math::Min(
+               monotonicity_left,
+               monotonicity_right
+           )
+         - k_sum_weight * sum;
+}
+
+const f32*
+get_rows_scores() noexcept
+{
+    // Function statics are initialized only once, even with threads.
+    static const std::vector<f32> s_scores = []() {
+        auto scores = std::vector<f32>(1 << 16);
+        for(auto row = 0u; row < scores.size(); ++row)
+            scores[row] = evaluate_row(u16(row));
+
+        return scores;
+    }();
+
+    return s_scores.data();
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+Solver::Solver(IValuesGenerator *p_values_generator) noexcept
+    : mp_values_generator(p_values_generator)
+    , mp_table     (nullptr)
+    , mp_pool      (nullptr)
+    , m_max_depth  (k_default_max_depth)
+    , m_time_budget(0)
+    , m_nodes_count(0)
+    , m_last_score (0)
+    , m_last_depth (0)
+{
+    // Empty...
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+Solver::Direction
+Solver::find_best_move(const BitBoard &board) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Take the values that the generator can generate right now.
+    m_chances.clear();
+    for(auto &value_chance : mp_values_generator->get_values_chances())
+    {
+        m_chances.push_back(std::make_pair(
+            BitBoard::value_to_exponent(value_chance.first),
+            value_chance.second
+        ));
+    }
+
+    if(mp_table)
+        mp_table->new_search();
+
+    m_nodes_count = 0;
+    m_deadline    = Clock::now() + m_time_budget;
+
+    auto best_dir = Direction::None;
+    m_last_score  = 0;
+    m_last_depth  = 0;
+
+    //--------------------------------------------------------------------------
+    // Without time budget just search the max depth, otherwise
+    // deepen until run out of time keeping the last complete result.
+    auto use_time    = (m_time_budget.count() != 0);
+    auto first_depth = (use_time) ? 1u : m_max_depth;
+
+    for(auto depth = first_depth; depth <= m_max_depth; ++depth)
+    {
+        auto context = SearchContext{0, false};
+        auto dir     = Direction::None;
+        auto score   = (mp_pool)
+            ? search_root_parallel(board, depth, &dir, context)
+            : search_root         (board, depth, &dir, context);
+
+        m_nodes_count += context.nodes_count;
+
+        // Even the first depth might be cut, but it's better
+        // have a partial answer than no answer at all.
+        if(context.out_of_time && best_dir != Direction::None)
+            break;
+
+        best_dir     = dir;
+        m_last_score = score;
+        m_last_depth = depth;
+
+        if(context.out_of_time)
+            break;
+    }
+
+    return best_dir;
+}
+
+
+//
+f32
+Solver::evaluate(const BitBoard &board) noexcept
+{
+    auto p_scores   = get_rows_scores();
+    auto transposed = board.transpose();
+
+    auto score = 0.0f;
+    for(auto i = 0u; i < BitBoard::k_size; ++i)
+    {
+        score += p_scores[board     .get_row(i)];
+        score += p_scores[transposed.get_row(i)];
+    }
+
+    return score;
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+f32
+Solver::search_root(
+    const BitBoard &board,
+    u32             depth,
+    Direction      *p_best_dir,
+    SearchContext  &context) const noexcept
+{
+    auto best_score = -std::numeric_limits<f32>::max();
+    *p_best_dir = Direction::None;
+
+    for(auto i = 0; i < k_directions_count; ++i)
+    {
+        auto dir   = Direction(i);
+        auto moved = board.move(dir);
+
+        if(moved == board)
+            continue;
+
+        auto score = search_chance(moved, depth -1, 1.0f, context);
+        if(score > best_score)
+        {
+            best_score  = score;
+            *p_best_dir = dir;
+        }
+    }
+
+    return (*p_best_dir != Direction::None) ? best_score : 0.0f;
+}
+
+f32
+Solver::search_root_parallel(
+    const BitBoard &board,
+    u32             depth,
+    Direction      *p_best_dir,
+    SearchContext  &context) const noexcept
+{
+    //--------------------------------------------------------------------------
+    // One task for each move, each empty cell and each value.
+    //   Tasks write on their own slots only and the slots are summed in
+    //   the same order as the serial search after all tasks finished.
+    struct Slot
+    {
+        BitBoard      board;
+        f32           chance;
+        f32           score;
+        SearchContext context;
+    };
+
+    auto     chance_depth = depth -1;
+    BitBoard moved_boards[k_directions_count];
+    std::vector<Slot> slots[k_directions_count];
+
+    for(auto i = 0; i < k_directions_count; ++i)
+    {
+        moved_boards[i] = board.move(Direction(i));
+        if(moved_boards[i] == board || chance_depth == 0)
+            continue;
+
+        auto &moved       = moved_boards[i];
+        auto  cell_chance = 1.0f / moved.count_empty();
+        auto  cells_count = BitBoard::k_size * BitBoard::k_size;
+
+        for(auto index = 0u; index < cells_count; ++index)
+        {
+            if(moved.get_exponent_at_index(index) != 0)
+                continue;
+
+            auto coord = acow::math::Coord();
+            coord.y = index / BitBoard::k_size;
+            coord.x = index % BitBoard::k_size;
+
+            for(auto &exponent_chance : m_chances)
+            {
+                auto slot = Slot{moved, 0, 0, SearchContext{0, false}};
+                slot.board.set_exponent_at(coord, exponent_chance.first);
+                slot.chance = cell_chance * exponent_chance.second;
+
+                slots[i].push_back(slot);
+            }
+        }
+    }
+
+    for(auto &dir_slots : slots)
+    {
+        for(auto &slot : dir_slots)
+        {
+            auto p_slot = &slot;
+            mp_pool->submit([this, p_slot, chance_depth]() {
+                p_slot->score = search_max(
+                    p_slot->board,
+                    chance_depth -1,
+                    p_slot->chance,
+                    p_slot->context
+                );
+            });
+        }
+    }
+    mp_pool->wait();
+
+    //--------------------------------------------------------------------------
+    // Gather the results.
+    auto best_score = -std::numeric_limits<f32>::max();
+    *p_best_dir = Direction::None;
+
+    for(auto i = 0; i < k_directions_count; ++i)
+    {
+        auto &moved = moved_boards[i];
+        if(moved == board)
+            continue;
+
+        ++context.nodes_count;
+
+        auto score = 0.0f;
+        if(chance_depth == 0)
+        {
+            score = evaluate(moved);
+        }
+        else
+        {
+            for(auto j = 0u; j < slots[i].size(); ++j)
+            {
+                auto &slot = slots[i][j];
+                auto &exponent_chance = m_chances[j % m_chances.size()];
+
+                score += exponent_chance.second * slot.score;
+
+                context.nodes_count += slot.context.nodes_count;
+                context.out_of_time |= slot.context.out_of_time;
+            }
+            score /= moved.count_empty();
+        }
+
+        if(score > best_score)
+        {
+            best_score  = score;
+            *p_best_dir = Direction(i);
+        }
+    }
+
+    return (*p_best_dir != Direction::None) ? best_score : 0.0f;
+}
+
+f32
+Solver::search_max(
+    const BitBoard &board,
+    u32             depth,
+    f32             chance,
+    SearchContext  &context) const noexcept
+{
+    auto best_score = 0.0f;
+    for(auto i = 0; i < k_directions_count; ++i)
+    {
+        auto moved = board.move(Direction(i));
+        if(moved == board)
+            continue;
+
+        best_score = acow::math::Max(
+            best_score,
+            search_chance(moved, depth, chance, context)
+        );
+    }
+
+    return best_score;
+}
+
+f32
+Solver::search_chance(
+    const BitBoard &board,
+    u32             depth,
+    f32             chance,
+    SearchContext  &context) const noexcept
+{
+    ++context.nodes_count;
+
+    //--------------------------------------------------------------------------
+    // Leaf.
+    if(depth == 0 || chance < k_min_chance || is_out_of_time(context))
+        return evaluate(board);
+
+    auto empty_count = board.count_empty();
+    if(empty_count == 0)
+        return evaluate(board);
+
+    //--------------------------------------------------------------------------
+    // Already searched at least this deep.
+    auto key   = u64(0);
+    auto score = 0.0f;
+    if(mp_table)
+    {
+        key = Zobrist::hash(board);
+        if(mp_table->probe(key, depth, &score))
+            return score;
+    }
+
+    //--------------------------------------------------------------------------
+    // Every empty cell is equally likely to get the new block,
+    // and the value of block is drawn from the generator chances.
+    auto cell_chance = chance / empty_count;
+
+    for(auto index = 0u; index < BitBoard::k_size * BitBoard::k_size; ++index)
+    {
+        if(board.get_exponent_at_index(index) != 0)
+            continue;
+
+        auto coord = acow::math::Coord();
+        coord.y = index / BitBoard::k_size;
+        coord.x = index % BitBoard::k_size;
+
+        for(auto &exponent_chance : m_chances)
+        {
+            auto spawned = board;
+            spawned.set_exponent_at(coord, exponent_chance.first);
+
+            score += exponent_chance.second * search_max(
+                spawned,
+                depth -1,
+                cell_chance * exponent_chance.second,
+                context
+            );
+        }
+    }
+
+    score /= empty_count;
+
+    // A search cut by time isn't worth keeping.
+    if(mp_table && !context.out_of_time)
+        mp_table->store(key, depth, score);
+
+    return score;
+}
+
+
+//
+bool
+Solver::is_out_of_time(SearchContext &context) const noexcept
+{
+    if(context.out_of_time)
+        return true;
+
+    if(m_time_budget.count() == 0 ||
+       context.nodes_count % k_time_check_interval)
+        return false;
+
+    context.out_of_time = (Clock::now() >= m_deadline);
+    return context.out_of_time;
+}
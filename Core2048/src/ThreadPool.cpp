@@ -0,0 +1,267 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ThreadPool.cpp                                                //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/ThreadPool.h"
+// AmazingCow Libs
+#include "acow/math_goodies.h"
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+// Index of the worker that is running in the current thread and its
+// pool, threads outside of the pools have no worker.
+constexpr auto k_no_worker = u32(-1);
+thread_local u32               t_worker_index = k_no_worker;
+thread_local const ThreadPool *t_pool         = nullptr;
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+ThreadPool::ThreadPool(u32 threads_count) noexcept
+    : m_queued_count (0)
+    , m_pending_count(0)
+    , m_next_worker  (0)
+    , m_stopping     (false)
+{
+    if(threads_count == 0)
+    {
+        auto hardware_count = std::thread::hardware_concurrency();
+        threads_count = acow::math::Max(hardware_count, 1u);
+    }
+
+    for(auto i = 0u; i < threads_count; ++i)
+    {
+        m_workers.push_back(std::unique_ptr<Worker>(new Worker()));
+        m_workers.back()->pinned_count = 0;
+    }
+
+    for(auto i = 0u; i < threads_count; ++i)
+        m_threads.push_back(std::thread(&ThreadPool::worker_loop, this, i));
+}
+
+ThreadPool::~ThreadPool() noexcept
+{
+    wait();
+
+    m_stopping = true;
+    notify_sleepers(true);
+
+    for(auto &thread : m_threads)
+        thread.join();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+void
+ThreadPool::submit(Task task) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Workers of other pools don't have a queue on this one.
+    auto index = (t_pool == this)
+        ? t_worker_index
+        : m_next_worker++ % m_workers.size();
+
+    ++m_pending_count;
+    ++m_queued_count;
+    {
+        auto &worker = *m_workers[index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        worker.tasks.push_back(std::move(task));
+    }
+
+    notify_sleepers(false);
+}
+
+void
+ThreadPool::submit_to(u32 worker_index, Task task) noexcept
+{
+    COREASSERT_ASSERT(
+        worker_index < m_workers.size(),
+        "Invalid worker index: %u",
+        worker_index
+    );
+
+    ++m_pending_count;
+    {
+        auto &worker = *m_workers[worker_index];
+        std::lock_guard<std::mutex> lock(worker.mutex);
+
+        worker.pinned_tasks.push_back(std::move(task));
+        ++worker.pinned_count;
+    }
+
+    //--------------------------------------------------------------------------
+    // Only that worker can take it, so all of them are woken.
+    notify_sleepers(true);
+}
+
+void
+ThreadPool::wait() noexcept
+{
+    while(m_pending_count != 0)
+    {
+        if(try_run_one(k_no_worker))
+            continue;
+
+        //----------------------------------------------------------------------
+        // Nothing to steal, the tasks left are running already.
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cond.wait(lock, [this]() {
+            return m_pending_count == 0 || m_queued_count != 0;
+        });
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+ThreadPool::worker_loop(u32 index) noexcept
+{
+    t_worker_index = index;
+    t_pool         = this;
+
+    auto &worker = *m_workers[index];
+    while(true)
+    {
+        if(try_run_one(index))
+            continue;
+
+        std::unique_lock<std::mutex> lock(m_sleep_mutex);
+        m_sleep_cond.wait(lock, [this, &worker]() {
+            return m_stopping
+                || m_queued_count      != 0
+                || worker.pinned_count != 0;
+        });
+
+        if(m_stopping && m_queued_count == 0)
+            break;
+    }
+}
+
+
+//
+bool
+ThreadPool::try_pop_pinned(u32 index, Task *p_task) noexcept
+{
+    auto &worker = *m_workers[index];
+    if(worker.pinned_count == 0)
+        return false;
+
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    *p_task = std::move(worker.pinned_tasks.front());
+    worker.pinned_tasks.pop_front();
+    --worker.pinned_count;
+
+    return true;
+}
+
+bool
+ThreadPool::try_pop(u32 index, Task *p_task) noexcept
+{
+    auto &worker = *m_workers[index];
+    std::lock_guard<std::mutex> lock(worker.mutex);
+
+    if(worker.tasks.empty())
+        return false;
+
+    *p_task = std::move(worker.tasks.back());
+    worker.tasks.pop_back();
+
+    return true;
+}
+
+bool
+ThreadPool::try_steal(u32 index, Task *p_task) noexcept
+{
+    auto workers_count = u32(m_workers.size());
+    for(auto i = 1u; i <= workers_count; ++i)
+    {
+        auto  victim = (index + i) % workers_count;
+        auto &worker = *m_workers[victim];
+
+        std::lock_guard<std::mutex> lock(worker.mutex);
+        if(worker.tasks.empty())
+            continue;
+
+        *p_task = std::move(worker.tasks.front());
+        worker.tasks.pop_front();
+
+        return true;
+    }
+
+    return false;
+}
+
+bool
+ThreadPool::try_run_one(u32 index) noexcept
+{
+    auto task   = Task();
+    auto pinned = (index != k_no_worker && try_pop_pinned(index, &task));
+
+    //--------------------------------------------------------------------------
+    // Threads outside of the pool have no queue, so they only steal.
+    //   The pinned tasks weren't counted as queued.
+    if(!pinned)
+    {
+        auto found = (index != k_no_worker && try_pop(index, &task)) ||
+                     try_steal((index != k_no_worker) ? index : 0, &task);
+        if(!found)
+            return false;
+
+        --m_queued_count;
+    }
+
+    task();
+
+    if(--m_pending_count == 0)
+        notify_sleepers(true);
+
+    return true;
+}
+
+
+//
+void
+ThreadPool::notify_sleepers(bool all) noexcept
+{
+    // Taking the lock makes sure that a thread that just checked the
+    // counters is already sleeping, otherwise it would miss the notify.
+    {
+        std::lock_guard<std::mutex> lock(m_sleep_mutex);
+    }
+
+    if(all)
+        m_sleep_cond.notify_all();
+    else
+        m_sleep_cond.notify_one();
+}
@@ -0,0 +1,146 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TranspositionTable.cpp                                        //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/TranspositionTable.h"
+// std
+#include <cstring> //memcpy
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// Data is packed as: value (bits 0-31), depth (32-47), generation (48-55).
+// An empty entry has all bits zeroed, that is never a valid data since
+// stored entries have depth of at least 1.
+inline u64
+pack_data(f32 value, u32 depth, u8 generation) noexcept
+{
+    u32 value_bits;
+    std::memcpy(&value_bits, &value, sizeof(value_bits));
+
+    return u64(value_bits)
+         | (u64(depth & 0xFFFF) << 32)
+         | (u64(generation)     << 48);
+}
+
+inline f32
+unpack_value(u64 data) noexcept
+{
+    auto value_bits = u32(data & 0xFFFFFFFF);
+
+    f32 value;
+    std::memcpy(&value, &value_bits, sizeof(value));
+
+    return value;
+}
+
+constexpr inline u32
+unpack_depth(u64 data) noexcept
+{
+    return u32((data >> 32) & 0xFFFF);
+}
+
+constexpr inline u8
+unpack_generation(u64 data) noexcept
+{
+    return u8((data >> 48) & 0xFF);
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+TranspositionTable::TranspositionTable(std::size_t memory_size) noexcept
+    : m_mask      (0)
+    , m_generation(0)
+{
+    //--------------------------------------------------------------------------
+    // Biggest power of 2 that fits in the memory.
+    auto entries_count = std::size_t(1);
+    while(entries_count * 2 * sizeof(Entry) <= memory_size)
+        entries_count *= 2;
+
+    m_entries.reset(new Entry[entries_count]);
+    m_mask = entries_count -1;
+
+    clear();
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+bool
+TranspositionTable::probe(u64 key, u32 min_depth, f32 *p_value) const noexcept
+{
+    auto &entry = m_entries[key & m_mask];
+
+    auto data         = entry.data        .load(std::memory_order_relaxed);
+    auto key_xor_data = entry.key_xor_data.load(std::memory_order_relaxed);
+
+    //--------------------------------------------------------------------------
+    // Other position, or a torn write.
+    if(data == 0 || (key_xor_data ^ data) != key)
+        return false;
+
+    if(unpack_depth(data) < min_depth)
+        return false;
+
+    *p_value = unpack_value(data);
+    return true;
+}
+
+void
+TranspositionTable::store(u64 key, u32 depth, f32 value) noexcept
+{
+    COREASSERT_ASSERT(depth > 0, "depth(%d) must be > 0", depth);
+
+    auto &entry    = m_entries[key & m_mask];
+    auto  old_data = entry.data.load(std::memory_order_relaxed);
+
+    //--------------------------------------------------------------------------
+    // Keep the deeper entry, unless it's from an older search.
+    if(old_data != 0                               &&
+       unpack_generation(old_data) == m_generation &&
+       unpack_depth     (old_data) >  depth)
+    {
+        return;
+    }
+
+    auto data = pack_data(value, depth, m_generation);
+    entry.key_xor_data.store(key ^ data, std::memory_order_relaxed);
+    entry.data        .store(data,       std::memory_order_relaxed);
+}
+
+void
+TranspositionTable::clear() noexcept
+{
+    for(auto i = std::size_t(0); i <= m_mask; ++i)
+    {
+        m_entries[i].key_xor_data.store(0, std::memory_order_relaxed);
+        m_entries[i].data        .store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,474 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : ValuesTable.cpp                                               //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/ValuesTable.h"
+// std
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <tuple>
+// POSIX
+#include <sys/stat.h>
+#if !defined(_WIN32)
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+// AmazingCow Libs
+#include "CoreAssert/CoreAssert.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr char k_magic[8] = { 'C', '2', '0', '4', '8', 'V', 'T', '\0' };
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// What tells the binary files apart. It's the file itself and not its
+// name, a file that was saved again under the same name is a new file.
+struct FileKey
+{
+#if !defined(_WIN32)
+    u64 device;
+    u64 inode;
+#else
+    std::string filename;
+#endif
+    u64 mtime; // Nanoseconds, where the system has them.
+    u64 size;
+
+    bool
+    operator<(const FileKey &other) const noexcept
+    {
+    #if !defined(_WIN32)
+        return std::tie(device, inode, mtime, size)
+             < std::tie(other.device, other.inode, other.mtime, other.size);
+    #else
+        return std::tie(filename, mtime, size)
+             < std::tie(other.filename, other.mtime, other.size);
+    #endif
+    }
+};
+
+FileKey
+make_file_key(const std::string &filename, const struct stat &file_stat)
+    noexcept
+{
+    auto key = FileKey();
+#if !defined(_WIN32)
+    key.device = u64(file_stat.st_dev);
+    key.inode  = u64(file_stat.st_ino);
+#else
+    key.filename = filename;
+#endif
+    //--------------------------------------------------------------------------
+    // A file saved twice in the same second is a new file too.
+#if defined(__APPLE__)
+    key.mtime = u64(file_stat.st_mtimespec.tv_sec) * 1000000000u
+              + u64(file_stat.st_mtimespec.tv_nsec);
+#elif !defined(_WIN32)
+    key.mtime = u64(file_stat.st_mtim.tv_sec) * 1000000000u
+              + u64(file_stat.st_mtim.tv_nsec);
+#else
+    key.mtime = u64(file_stat.st_mtime);
+#endif
+    key.size  = u64(file_stat.st_size);
+
+    (void)filename;
+    return key;
+}
+
+// The binary tables that are alive, by file.
+std::map<FileKey, std::weak_ptr<const ValuesTable>>&
+get_loaded_tables(std::mutex **pp_mutex) noexcept
+{
+    static std::mutex s_mutex;
+    static std::map<FileKey, std::weak_ptr<const ValuesTable>> s_tables;
+
+    *pp_mutex = &s_mutex;
+    return s_tables;
+}
+
+
+//----------------------------------------------------------------------------//
+// Factories                                                                  //
+//----------------------------------------------------------------------------//
+std::shared_ptr<const ValuesTable>
+ValuesTable::load(const std::string &filename) noexcept
+{
+    char magic[sizeof(k_magic)] = {};
+
+    std::ifstream in_stream(filename, std::ios::binary);
+    in_stream.read(magic, sizeof(magic));
+
+    if(in_stream && memcmp(magic, k_magic, sizeof(k_magic)) == 0)
+        return load_binary(filename);
+
+    return load_text(filename);
+}
+
+std::shared_ptr<const ValuesTable>
+ValuesTable::load_text(const std::string &filename) noexcept
+{
+    //Open File.
+    std::ifstream in_stream;
+    in_stream.open(filename);
+
+    COREASSERT_ASSERT(
+        in_stream.is_open(),
+        "Cannot open file: (%s)",
+        filename.c_str()
+    );
+
+    auto p_table = std::shared_ptr<ValuesTable>(new ValuesTable());
+    p_table->m_rows.resize(k_rows_count, Row{0, 0});
+
+    // Parse File.
+    // Data is this format:
+    //    Max Curr Value | GenMax (chance percent)
+    //    int() char('|') int() char('(') (int) char(')')
+    // Lines starting with # are ignored.
+    // Whitespace are ignored.
+    auto values   = std::vector<u32>();
+    auto percents = std::vector<u32>();
+
+    std::string line;
+    while(std::getline(in_stream, line))
+    {
+        // Comments - Ignore.
+        if(line.size() != 0 && line[0] == '#')
+            continue;
+
+        u32 MaxCurrValue, GenMax, ChangePercent;
+        u8  dummy;
+
+        std::stringstream ss(line);
+        if(!(ss >> MaxCurrValue >> dummy))
+            continue; // Blank lines - Ignore.
+
+        values  .clear();
+        percents.clear();
+
+        std::string gen_per_token;
+        while(ss >> gen_per_token)
+        {
+            auto matches = sscanf(
+                gen_per_token.c_str(), "%u(%u)", &GenMax, &ChangePercent
+            );
+
+            COREASSERT_ASSERT(
+                matches == 2,
+                "Invalid token (%s) on file: (%s)",
+                gen_per_token.c_str(),
+                filename.c_str()
+            );
+
+            values  .push_back(GenMax);
+            percents.push_back(ChangePercent);
+        }
+
+        p_table->add_row(MaxCurrValue, values, percents);
+    }
+
+    p_table->mp_rows         = p_table->m_rows.data();
+    p_table->mp_entries      = p_table->m_entries.data();
+    p_table->m_entries_count = u32(p_table->m_entries.size());
+
+    return p_table;
+}
+
+std::shared_ptr<const ValuesTable>
+ValuesTable::load_binary(const std::string &filename) noexcept
+{
+    //--------------------------------------------------------------------------
+    // Map the whole file, unless a table of it is still alive.
+    auto p_mapping = static_cast<void*>(nullptr);
+    auto size      = size_t(0);
+
+    struct stat file_stat;
+    std::mutex *p_mutex = nullptr;
+    auto       &tables  = get_loaded_tables(&p_mutex);
+    auto        lock    = std::unique_lock<std::mutex>(*p_mutex);
+
+#if !defined(_WIN32)
+    auto fd = open(filename.c_str(), O_RDONLY);
+    COREASSERT_ASSERT(fd != -1, "Cannot open file: (%s)", filename.c_str());
+    if(fd == -1)
+        return nullptr;
+
+    if(fstat(fd, &file_stat) != 0)
+        file_stat.st_size = 0;
+
+    auto key      = make_file_key(filename, file_stat);
+    auto p_loaded = tables[key].lock();
+    if(p_loaded)
+    {
+        close(fd);
+        return p_loaded;
+    }
+
+    if(file_stat.st_size > 0)
+    {
+        size      = size_t(file_stat.st_size);
+        p_mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+        if(p_mapping == MAP_FAILED)
+            p_mapping = nullptr;
+    }
+    close(fd); // The mapping keeps the file.
+#else
+    if(stat(filename.c_str(), &file_stat) != 0)
+        file_stat.st_size = 0;
+
+    auto key      = make_file_key(filename, file_stat);
+    auto p_loaded = tables[key].lock();
+    if(p_loaded)
+        return p_loaded;
+
+    // No mmap(), reads the file into memory instead.
+    std::ifstream in_stream(filename, std::ios::binary | std::ios::ate);
+    if(in_stream && in_stream.tellg() > 0)
+    {
+        size      = size_t(in_stream.tellg());
+        p_mapping = malloc(size);
+
+        in_stream.seekg(0);
+        in_stream.read(static_cast<char*>(p_mapping), size);
+    }
+#endif
+
+    COREASSERT_ASSERT(
+        p_mapping != nullptr,
+        "Cannot map file: (%s)",
+        filename.c_str()
+    );
+    if(!p_mapping)
+        return nullptr;
+
+    auto p_table = std::shared_ptr<ValuesTable>(new ValuesTable());
+    p_table->mp_mapping     = p_mapping;
+    p_table->m_mapping_size = size;
+
+    //--------------------------------------------------------------------------
+    // Check that the file is a valid table before using it.
+    auto p_header = static_cast<const Header*>(p_mapping);
+    auto p_data   = static_cast<const u8*>(p_mapping) + sizeof(Header);
+
+    auto data_size = size - sizeof(Header);
+    auto is_valid  = size >= sizeof(Header)
+        && memcmp(p_header->magic, k_magic, sizeof(k_magic)) == 0
+        && p_header->version    == k_version
+        && p_header->rows_count == k_rows_count
+        && data_size == sizeof(Row  ) * p_header->rows_count
+                      + sizeof(Entry) * size_t(p_header->entries_count)
+        && p_header->checksum == calculate_checksum(p_data, data_size);
+
+    //--------------------------------------------------------------------------
+    // The rows must be inside the entries, they aren't checked again
+    // when the values are drawn.
+    auto p_rows = reinterpret_cast<const Row*>(p_data);
+    for(auto i = 0u; is_valid && i < k_rows_count; ++i)
+    {
+        is_valid = p_rows[i].entries_count <= k_max_row_entries
+            && u64(p_rows[i].first_entry) + p_rows[i].entries_count
+               <= p_header->entries_count;
+    }
+
+    COREASSERT_ASSERT(
+        is_valid,
+        "Invalid values table (version %u expected) on file: (%s)",
+        k_version,
+        filename.c_str()
+    );
+    if(!is_valid)
+        return nullptr;
+
+    p_table->mp_rows         = p_rows;
+    p_table->mp_entries      = reinterpret_cast<const Entry*>(
+        p_data + sizeof(Row) * k_rows_count
+    );
+    p_table->m_entries_count = p_header->entries_count;
+
+    //--------------------------------------------------------------------------
+    // Files saved again leave the keys of their old tables behind.
+    for(auto it = tables.begin(); it != tables.end(); )
+        it = it->second.expired() ? tables.erase(it) : std::next(it);
+
+    tables[key] = p_table;
+    return p_table;
+}
+
+
+//----------------------------------------------------------------------------//
+// CTOR / DTOR                                                                //
+//----------------------------------------------------------------------------//
+ValuesTable::ValuesTable() noexcept
+    : mp_mapping     (nullptr)
+    , m_mapping_size (0)
+    , mp_rows        (nullptr)
+    , mp_entries     (nullptr)
+    , m_entries_count(0)
+{
+    // Empty...
+}
+
+ValuesTable::~ValuesTable() noexcept
+{
+    if(!mp_mapping)
+        return;
+
+#if !defined(_WIN32)
+    munmap(mp_mapping, m_mapping_size);
+#else
+    free(mp_mapping);
+#endif
+}
+
+
+//----------------------------------------------------------------------------//
+// Public Methods                                                             //
+//----------------------------------------------------------------------------//
+bool
+ValuesTable::save_binary(const std::string &filename) const noexcept
+{
+    auto header = Header();
+    memcpy(header.magic, k_magic, sizeof(k_magic));
+    header.version       = k_version;
+    header.rows_count    = k_rows_count;
+    header.entries_count = m_entries_count;
+    header.checksum      = get_checksum();
+
+    //--------------------------------------------------------------------------
+    // The table is written aside and then renamed over the file, so the
+    // tables that have the old file mapped keep seeing it as it was.
+    auto temp_filename = filename + ".tmp";
+
+    std::ofstream out_stream(
+        temp_filename,
+        std::ios::binary | std::ios::trunc
+    );
+    out_stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    out_stream.write(
+        reinterpret_cast<const char*>(mp_rows),
+        sizeof(Row) * k_rows_count
+    );
+    out_stream.write(
+        reinterpret_cast<const char*>(mp_entries),
+        sizeof(Entry) * m_entries_count
+    );
+    out_stream.close();
+
+    auto is_written = bool(out_stream);
+#if defined(_WIN32)
+    // rename() doesn't replace files there.
+    if(is_written)
+        std::remove(filename.c_str());
+#endif
+    if(is_written && std::rename(temp_filename.c_str(), filename.c_str()) == 0)
+        return true;
+
+    std::remove(temp_filename.c_str());
+    return false;
+}
+
+u32
+ValuesTable::get_checksum() const noexcept
+{
+    // The rows and the entries as they're on file.
+    auto checksum = calculate_checksum(mp_rows, sizeof(Row) * k_rows_count);
+    return calculate_checksum(
+        mp_entries,
+        sizeof(Entry) * m_entries_count,
+        checksum
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Private Methods                                                            //
+//----------------------------------------------------------------------------//
+void
+ValuesTable::add_row(
+    u32                     max_value,
+    const std::vector<u32> &values,
+    const std::vector<u32> &percents) noexcept
+{
+    auto count = u32(values.size());
+    auto total = u64(0);
+    for(auto percent : percents)
+        total += percent;
+
+    COREASSERT_ASSERT(
+        max_value >= 2 && count != 0 && count <= k_max_row_entries,
+        "Invalid row for max value (%u) with (%u) values.",
+        max_value,
+        count
+    );
+    COREASSERT_ASSERT(
+        total != 0,
+        "Row for max value (%u) has no chances.",
+        max_value
+    );
+
+    auto &row = m_rows[31 - u32(__builtin_clz(max_value))];
+
+    row.first_entry   = u32(m_entries.size());
+    row.entries_count = count;
+
+    auto weights = std::vector<u64>(count);
+    auto indices = std::vector<u32>(count);
+
+    m_entries.resize(m_entries.size() + count);
+    build_alias_entries(
+        values.data(),
+        percents.data(),
+        count,
+        &m_entries[row.first_entry],
+        weights.data(),
+        indices.data()
+    );
+}
+
+u32
+ValuesTable::calculate_checksum(
+    const void *p_data,
+    size_t      size,
+    u32         hash) noexcept
+{
+    // FNV-1a.
+    auto p_bytes = static_cast<const u8*>(p_data);
+
+    for(auto i = size_t(0); i < size; ++i)
+    {
+        hash ^= p_bytes[i];
+        hash *= 16777619u;
+    }
+
+    return hash;
+}
@@ -0,0 +1,139 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : Zobrist.cpp                                                   //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// Header
+#include "../include/Zobrist.h"
+// std
+#include <vector>
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// The xor of the keys of all blocks of a BitBoard row, for every row of
+// every possible packed row. So a BitBoard is hashed with 4 lookups.
+const u64*
+get_rows_keys() noexcept
+{
+    constexpr auto k_rows_count = 1u << 16;
+
+    // Function statics are initialized only once, even with threads.
+    static const std::vector<u64> s_keys = []() {
+        auto keys = std::vector<u64>(BitBoard::k_size * k_rows_count, 0);
+        for(auto y = 0u; y < BitBoard::k_size; ++y)
+        {
+            for(auto row = 0u; row < k_rows_count; ++row)
+            {
+                auto &key = keys[y * k_rows_count + row];
+                for(auto x = 0u; x < BitBoard::k_size; ++x)
+                {
+                    auto exponent = (row >> (x * 4)) & 0xF;
+                    auto index    = y * BitBoard::k_size + x;
+
+                    if(exponent != 0)
+                        key ^= Zobrist::get_key(index, exponent);
+                }
+            }
+        }
+
+        return keys;
+    }();
+
+    return s_keys.data();
+}
+
+
+//----------------------------------------------------------------------------//
+// Static Methods                                                             //
+//----------------------------------------------------------------------------//
+u64
+Zobrist::hash(const BitBoard &board) noexcept
+{
+    auto p_keys = get_rows_keys();
+    auto hash   = u64(0);
+
+    for(auto y = 0u; y < BitBoard::k_size; ++y)
+        hash ^= p_keys[(y << 16) | board.get_row(y)];
+
+    return hash;
+}
+
+u64
+Zobrist::hash(const GameCore &core) noexcept
+{
+    auto hash  = u64(0);
+    auto coord = acow::math::Coord();
+
+    for(coord.y = 0; coord.y < int(core.get_height()); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(core.get_width()); ++coord.x)
+        {
+            auto p_block = core.get_block_at(coord);
+            if(p_block)
+            {
+                hash ^= get_key(
+                    coord,
+                    core.get_width(),
+                    p_block->get_value()
+                );
+            }
+        }
+    }
+
+    return hash;
+}
+
+
+//
+u64
+Zobrist::update(u64 hash, const GameCore::MoveResult &move_result) noexcept
+{
+    auto get_event_key = [](u32 cell_index, u32 value) {
+        return get_key(cell_index, u32(__builtin_ctz(value)));
+    };
+
+    //--------------------------------------------------------------------------
+    // The events have the cells and values of the blocks before and
+    // after the move, moved blocks take the merged ones that moved too.
+    for(auto &event : move_result.moved_blocks)
+    {
+        hash ^= get_event_key(event.from, event.old_value);
+        hash ^= get_event_key(event.to,   event.new_value);
+    }
+
+    for(auto &event : move_result.merged_blocks)
+    {
+        if(event.from != event.to)
+            continue;
+
+        hash ^= get_event_key(event.to, event.old_value);
+        hash ^= get_event_key(event.to, event.new_value);
+    }
+
+    //--------------------------------------------------------------------------
+    // Removed blocks never move.
+    for(auto &event : move_result.removed_blocks)
+        hash ^= get_event_key(event.from, event.old_value);
+
+    return hash;
+}
@@ -0,0 +1,1269 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+
+
+//----------------------------------------------------------------------------//
+// Allocations Counter                                                        //
+//----------------------------------------------------------------------------//
+// Every allocation of the program goes through these, so the benchmarks
+// can tell how many allocations the timed code did.
+std::atomic<u64> g_allocations_count(0);
+
+void*
+operator new(std::size_t size)
+{
+    g_allocations_count.fetch_add(1, std::memory_order_relaxed);
+
+    auto p_memory = std::malloc(size ? size : 1);
+    if(!p_memory)
+        throw std::bad_alloc();
+
+    return p_memory;
+}
+
+void*
+operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete  (void *p_memory) noexcept { std::free(p_memory); }
+void operator delete[](void *p_memory) noexcept { std::free(p_memory); }
+
+void
+operator delete(void *p_memory, std::size_t /* size */) noexcept
+{
+    std::free(p_memory);
+}
+
+void
+operator delete[](void *p_memory, std::size_t /* size */) noexcept
+{
+    std::free(p_memory);
+}
+
+
+//----------------------------------------------------------------------------//
+// Values Generator                                                           //
+//----------------------------------------------------------------------------//
+// The preset values don't cover the values that big boards reach,
+// so the benchmarks use the classic 2 (90%) / 4 (10%) split.
+class BenchValuesGenerator
+    : public Core2048::IValuesGenerator
+{
+public:
+    virtual u32
+    generate_value(Core2048::Random &rnd_gen) noexcept override
+    {
+        return (rnd_gen.next(0, 9) == 0) ? 4 : 2;
+    }
+
+    virtual void
+    set_max_value(u32 /* value */) noexcept override
+    {
+        // Empty...
+    }
+
+    virtual ValuesChances
+    get_values_chances() const noexcept override
+    {
+        return { {2, 0.9f}, {4, 0.1f} };
+    }
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+typedef std::chrono::steady_clock Clock;
+
+double
+elapsed_ns(const Clock::time_point &start) noexcept
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start)
+        .count();
+}
+
+// Sums the time and the allocations of the measured operations.
+struct Measure
+{
+    double total_ns;
+    u64    allocations_count;
+    u32    ops_count;
+};
+
+template <typename Func>
+void
+measure(Measure &m, Func func) noexcept
+{
+    auto allocations = g_allocations_count.load(std::memory_order_relaxed);
+    auto start       = Clock::now();
+
+    func();
+
+    m.total_ns          += elapsed_ns(start);
+    m.allocations_count += g_allocations_count.load(std::memory_order_relaxed)
+                         - allocations;
+    ++m.ops_count;
+}
+
+// Only the benchmarks with the filter in theirs names are run,
+// an empty filter runs all of them.
+std::string g_filter;
+
+bool
+should_run(const std::string &name) noexcept
+{
+    return g_filter.empty() || name.find(g_filter) != std::string::npos;
+}
+
+void
+report(const std::string &name, const Measure &m) noexcept
+{
+    printf(
+        "%-44s \t%12.1f ns/op \t%8.2f allocs/op\n",
+        name.c_str(),
+        m.total_ns / m.ops_count,
+        double(m.allocations_count) / m.ops_count
+    );
+}
+
+std::string
+get_bench_name(
+    const char *p_name,
+    const char *p_variant,
+    u32         size,
+    f32         fill_ratio) noexcept
+{
+    char buffer[128];
+    snprintf(
+        buffer,
+        sizeof(buffer),
+        "%s/%s/%ux%u/fill:%u%%",
+        p_name,
+        p_variant,
+        size,
+        size,
+        u32(fill_ratio * 100)
+    );
+
+    return buffer;
+}
+
+const char*
+direction_name(Core2048::GameCore::Direction direction) noexcept
+{
+    switch(direction)
+    {
+        case Core2048::GameCore::Direction::Left : return "left";
+        case Core2048::GameCore::Direction::Up   : return "up";
+        case Core2048::GameCore::Direction::Right: return "right";
+        case Core2048::GameCore::Direction::Down : return "down";
+        case Core2048::GameCore::Direction::None : return "none";
+    }
+
+    return "";
+}
+
+std::unique_ptr<Core2048::GameCore>
+create_filled_core(
+    Core2048::IValuesGenerator *p_values_gen,
+    u32                        size,
+    i32                        seed,
+    f32                        fill_ratio) noexcept
+{
+    auto p_core = std::make_unique<Core2048::GameCore>(
+        p_values_gen, size, size, seed
+    );
+
+    // The core already generated the first block.
+    auto blocks_count = u32(size * size * fill_ratio);
+    for(auto i = 1u; i < blocks_count; ++i)
+        p_core->generate_next_block();
+
+    return p_core;
+}
+
+std::vector<std::unique_ptr<Core2048::GameCore>>
+create_filled_cores(
+    Core2048::IValuesGenerator *p_values_gen,
+    u32                        size,
+    f32                        fill_ratio,
+    u32                        cores_count) noexcept
+{
+    auto cores = std::vector<std::unique_ptr<Core2048::GameCore>>();
+    for(auto i = 0u; i < cores_count; ++i)
+        cores.push_back(create_filled_core(p_values_gen, size, i, fill_ratio));
+
+    return cores;
+}
+
+std::vector<Core2048::BitBoardGameCore>
+create_filled_bitboard_cores(
+    Core2048::IValuesGenerator *p_values_gen,
+    f32                        fill_ratio,
+    u32                        cores_count) noexcept
+{
+    auto cells_count = Core2048::BitBoard::k_size * Core2048::BitBoard::k_size;
+    auto cores       = std::vector<Core2048::BitBoardGameCore>();
+
+    for(auto i = 0u; i < cores_count; ++i)
+    {
+        cores.emplace_back(p_values_gen, i32(i));
+
+        // The core already generated the first block.
+        auto blocks_count = u32(cells_count * fill_ratio);
+        for(auto j = 1u; j < blocks_count; ++j)
+            cores.back().generate_next_block();
+    }
+
+    return cores;
+}
+
+
+//----------------------------------------------------------------------------//
+// Benchmarks                                                                 //
+//----------------------------------------------------------------------------//
+constexpr auto k_cores_count = 16u; // Different boards of each benchmark.
+
+// A move on a copy of a board, the copy isn't timed.
+void
+bench_make_move(
+    Core2048::GameCore::Direction direction,
+    u32                           size,
+    f32                           fill_ratio,
+    u32                           ops_count) noexcept
+{
+    auto name = get_bench_name(
+        "make_move", direction_name(direction), size, fill_ratio
+    );
+    if(!should_run(name))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, fill_ratio, k_cores_count
+    );
+
+    auto m = Measure{0, 0, 0};
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto core = *cores[i % k_cores_count];
+        measure(m, [&]() { core.make_move(direction); });
+    }
+
+    report(name, m);
+}
+
+//
+void
+bench_is_valid_move(
+    Core2048::GameCore::Direction direction,
+    u32                           size,
+    f32                           fill_ratio,
+    u32                           ops_count) noexcept
+{
+    auto name = get_bench_name(
+        "is_valid_move", direction_name(direction), size, fill_ratio
+    );
+    if(!should_run(name))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, fill_ratio, k_cores_count
+    );
+
+    auto m     = Measure{0, 0, 0};
+    auto valid = 0u;
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto &core = *cores[i % k_cores_count];
+        measure(m, [&]() { valid += core.is_valid_move(direction); });
+    }
+
+    report(name, m);
+}
+
+// The same boards of bench_make_move() on a BitBoardGameCore, they're
+// played from the same seeds, so both cores get the same boards.
+void
+bench_bitboard_make_move(
+    Core2048::GameCore::Direction direction,
+    f32                           fill_ratio,
+    u32                           ops_count) noexcept
+{
+    auto name = get_bench_name(
+        "make_move/bitboard", direction_name(direction),
+        Core2048::BitBoard::k_size, fill_ratio
+    );
+    if(!should_run(name))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_bitboard_cores(
+        &values_gen, fill_ratio, k_cores_count
+    );
+
+    auto m = Measure{0, 0, 0};
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto core = cores[i % k_cores_count];
+        measure(m, [&]() { core.make_move(direction); });
+    }
+
+    report(name, m);
+}
+
+//
+void
+bench_bitboard_is_valid_move(
+    Core2048::GameCore::Direction direction,
+    f32                           fill_ratio,
+    u32                           ops_count) noexcept
+{
+    auto name = get_bench_name(
+        "is_valid_move/bitboard", direction_name(direction),
+        Core2048::BitBoard::k_size, fill_ratio
+    );
+    if(!should_run(name))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_bitboard_cores(
+        &values_gen, fill_ratio, k_cores_count
+    );
+
+    auto m     = Measure{0, 0, 0};
+    auto valid = 0u;
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto &core = cores[i % k_cores_count];
+        measure(m, [&]() { valid += core.is_valid_move(direction); });
+    }
+
+    report(name, m);
+}
+
+// check_status() is private, it runs after each move and each block
+// generation. Only full boards are looked at for merges, so what is timed
+// is the block that fills the last empty cell of a copy of a board, the
+// copy isn't timed. Random boards most often have a merge right away,
+// boards with no merges left are scanned to the end and lose.
+void
+bench_check_status(u32 size, u32 ops_count) noexcept
+{
+    auto random_name = get_bench_name(
+        "check_status", "last_block/random", size, 1.0f
+    );
+    if(should_run(random_name))
+    {
+        auto values_gen = BenchValuesGenerator();
+        auto cores      = create_filled_cores(
+            &values_gen, size, 1.0f - 1.0f / (size * size), k_cores_count
+        );
+
+        auto m     = Measure{0, 0, 0};
+        auto valid = 0u;
+        for(auto i = 0u; i < ops_count; ++i)
+        {
+            auto core = *cores[i % k_cores_count];
+            measure(m, [&]() {
+                core.generate_next_block();
+                valid += (core.get_status() == CoreGame::Status::Continue);
+            });
+        }
+
+        report(random_name, m);
+    }
+
+    auto no_merges_name = get_bench_name(
+        "check_status", "last_block/no_merges", size, 1.0f
+    );
+    if(should_run(no_merges_name))
+    {
+        //----------------------------------------------------------------------
+        // 2s and 4s as a checkerboard that goes along with the first
+        // block, the cell of a corner is left out for the timed block.
+        auto values_gen = BenchValuesGenerator();
+        auto base_core  = Core2048::GameCore(&values_gen, size, size, 0);
+
+        auto first = acow::math::Coord();
+        while(!base_core.get_block_at(first))
+        {
+            first.y += (first.x + 1) / int(size);
+            first.x  = (first.x + 1) % int(size);
+        }
+
+        auto value    = base_core.get_block_at(first)->get_value();
+        auto value_at = [&](const acow::math::Coord &coord) {
+            auto is_same = (coord.y + coord.x + first.y + first.x) % 2 == 0;
+            return (is_same == (value == 2)) ? 2u : 4u;
+        };
+
+        auto last = acow::math::Coord();
+        if(first.y == 0 && first.x == 0)
+            last.x = 1;
+
+        auto coord = acow::math::Coord();
+        for(coord.y = 0; coord.y < int(size); ++coord.y)
+        {
+            for(coord.x = 0; coord.x < int(size); ++coord.x)
+            {
+                auto is_last = (coord.y == last.y && coord.x == last.x);
+                if(!is_last && !base_core.get_block_at(coord))
+                    base_core.generate_next_block(coord, value_at(coord));
+            }
+        }
+
+        auto m     = Measure{0, 0, 0};
+        auto valid = 0u;
+        for(auto i = 0u; i < ops_count; ++i)
+        {
+            auto core = base_core;
+            measure(m, [&]() {
+                core.generate_next_block(last, value_at(last));
+                valid += (core.get_status() == CoreGame::Status::Continue);
+            });
+        }
+
+        report(no_merges_name, m);
+    }
+}
+
+// A block on a copy of a board with only a few empty cells left.
+void
+bench_generate_next_block(
+    u32 size,
+    u32 empty_cells_count,
+    u32 ops_count) noexcept
+{
+    auto fill_ratio = 1.0f - f32(empty_cells_count) / (size * size);
+    auto variant    = std::to_string(empty_cells_count) + "_empty";
+
+    auto name = get_bench_name(
+        "generate_next_block", variant.c_str(), size, fill_ratio
+    );
+    if(!should_run(name))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, fill_ratio, k_cores_count
+    );
+
+    auto m = Measure{0, 0, 0};
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto core = *cores[i % k_cores_count];
+        measure(m, [&]() { core.generate_next_block(); });
+    }
+
+    report(name, m);
+}
+
+//
+void
+bench_preset_values_generator(
+    const std::string &filename,
+    u32                ops_count) noexcept
+{
+    //--------------------------------------------------------------------------
+    // The generator asserts on missing files.
+    if(!std::ifstream(filename).good())
+    {
+        printf("preset_values_generator \tskipped, no %s\n",
+               filename.c_str());
+        return;
+    }
+
+    if(should_run("preset_values_generator/construction"))
+    {
+        auto m = Measure{0, 0, 0};
+        for(auto i = 0u; i < ops_count / 100; ++i)
+        {
+            measure(m, [&]() {
+                auto generator = Core2048::PresetValuesGenerator(filename);
+            });
+        }
+
+        report("preset_values_generator/construction", m);
+    }
+
+    if(should_run("preset_values_generator/construction_shared"))
+    {
+        auto p_table = Core2048::ValuesTable::load(filename);
+
+        auto m = Measure{0, 0, 0};
+        for(auto i = 0u; i < ops_count / 100; ++i)
+        {
+            measure(m, [&]() {
+                auto generator = Core2048::PresetValuesGenerator(p_table);
+            });
+        }
+
+        report("preset_values_generator/construction_shared", m);
+    }
+
+    if(should_run("preset_values_generator/generate_value"))
+    {
+        auto generator = Core2048::PresetValuesGenerator(filename);
+        auto random    = Core2048::Random(1);
+        auto sum       = 0u;
+
+        generator.set_max_value(1024);
+
+        auto m = Measure{0, 0, 0};
+        for(auto i = 0u; i < ops_count; ++i)
+            measure(m, [&]() { sum += generator.generate_value(random); });
+
+        report("preset_values_generator/generate_value", m);
+    }
+}
+
+// Turns (a move and a block) on copies of boards with and without the
+// journal, and an undo() and a redo() of the last turn.
+void
+bench_journal(u32 size, u32 ops_count) noexcept
+{
+    auto name_off  = get_bench_name("journal", "turn_off",  size, 0.5f);
+    auto name_on   = get_bench_name("journal", "turn_on",   size, 0.5f);
+    auto name_undo = get_bench_name("journal", "undo_redo", size, 0.5f);
+    if(!should_run(name_off) && !should_run(name_on) && !should_run(name_undo))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, 0.5f, k_cores_count
+    );
+
+    auto m_off  = Measure{0, 0, 0};
+    auto m_on   = Measure{0, 0, 0};
+    auto m_undo = Measure{0, 0, 0};
+
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto direction = Core2048::GameCore::Direction(i % 4);
+        auto core      = *cores[i % k_cores_count];
+        if(!core.is_valid_move(direction))
+            continue;
+
+        auto journaled = core;
+        journaled.set_journal_capacity(64);
+
+        measure(m_off, [&]() {
+            core.make_move(direction);
+            core.generate_next_block();
+        });
+        measure(m_on, [&]() {
+            journaled.make_move(direction);
+            journaled.generate_next_block();
+        });
+        measure(m_undo, [&]() {
+            journaled.undo();
+            journaled.redo();
+        });
+    }
+
+    if(should_run(name_off )) report(name_off,  m_off );
+    if(should_run(name_on  )) report(name_on,   m_on  );
+    if(should_run(name_undo)) report(name_undo, m_undo);
+}
+
+// Ways of cloning a game: copying the GameCore, taking a snapshot and
+// restoring it on another game, and forking into another game.
+void
+bench_clone(u32 size, u32 ops_count) noexcept
+{
+    auto name_copy     = get_bench_name("clone", "copy",     size, 0.5f);
+    auto name_snapshot = get_bench_name("clone", "snapshot", size, 0.5f);
+    auto name_restore  = get_bench_name("clone", "restore",  size, 0.5f);
+    auto name_fork     = get_bench_name("clone", "fork",     size, 0.5f);
+    if(!should_run(name_copy)    && !should_run(name_snapshot) &&
+       !should_run(name_restore) && !should_run(name_fork))
+    {
+        return;
+    }
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, 0.5f, k_cores_count
+    );
+    auto target = *cores[0];
+
+    auto m_copy     = Measure{0, 0, 0};
+    auto m_snapshot = Measure{0, 0, 0};
+    auto m_restore  = Measure{0, 0, 0};
+    auto m_fork     = Measure{0, 0, 0};
+
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto &core     = *cores[i % k_cores_count];
+        auto  snapshot = Core2048::GameCore::Snapshot();
+
+        measure(m_copy,     [&]() { auto copy = core; (void)copy;    });
+        measure(m_snapshot, [&]() { snapshot = core.snapshot();      });
+        measure(m_restore,  [&]() { target.restore(snapshot);        });
+        measure(m_fork,     [&]() { core.fork(&target);              });
+    }
+
+    if(should_run(name_copy    )) report(name_copy,     m_copy    );
+    if(should_run(name_snapshot)) report(name_snapshot, m_snapshot);
+    if(should_run(name_restore )) report(name_restore,  m_restore );
+    if(should_run(name_fork    )) report(name_fork,     m_fork    );
+}
+
+// Games that are created, make a few turns and are destroyed, taking
+// theirs memory from the heap and from an arena that they all share.
+void
+bench_arena(u32 size, u32 ops_count) noexcept
+{
+    auto name_heap  = get_bench_name("arena", "heap",  size, 0.0f);
+    auto name_arena = get_bench_name("arena", "arena", size, 0.0f);
+    if(!should_run(name_heap) && !should_run(name_arena))
+        return;
+
+    constexpr auto k_turns_count = 8;
+
+    auto values_gen = BenchValuesGenerator();
+    auto play_game  = [&](u32 seed, Core2048::Arena *p_arena) {
+        auto core = Core2048::GameCore(&values_gen, size, size, seed, p_arena);
+        for(auto i = 0; i < k_turns_count; ++i)
+        {
+            auto direction = Core2048::GameCore::Direction(i % 4);
+            if(core.make_move(direction).move_valid)
+                core.generate_next_block();
+        }
+    };
+
+    Core2048::Arena arena;
+
+    auto m_heap  = Measure{0, 0, 0};
+    auto m_arena = Measure{0, 0, 0};
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        measure(m_heap,  [&]() { play_game(i, nullptr); });
+        measure(m_arena, [&]() { play_game(i, &arena);  });
+    }
+
+    if(should_run(name_heap )) report(name_heap,  m_heap );
+    if(should_run(name_arena)) report(name_arena, m_arena);
+}
+
+// Turns on copies of boards without and with a record writer, the first
+// turn of the record writes its header so it isn't timed.
+void
+bench_record(u32 size, u32 ops_count) noexcept
+{
+    typedef Core2048::GameRecord::Spawns Spawns;
+
+    auto name_off   = get_bench_name("record", "turn_off",   size, 0.5f);
+    auto name_seed  = get_bench_name("record", "turn_seed",  size, 0.5f);
+    auto name_cells = get_bench_name("record", "turn_cells", size, 0.5f);
+    if(!should_run(name_off) && !should_run(name_seed) &&
+       !should_run(name_cells))
+    {
+        return;
+    }
+
+    auto values_gen = BenchValuesGenerator();
+    auto cores      = create_filled_cores(
+        &values_gen, size, 0.5f, k_cores_count
+    );
+
+    auto m_off   = Measure{0, 0, 0};
+    auto m_seed  = Measure{0, 0, 0};
+    auto m_cells = Measure{0, 0, 0};
+
+    std::ostringstream seed_stream (std::ios::binary);
+    std::ostringstream cells_stream(std::ios::binary);
+
+    for(auto i = 0u; i < ops_count; ++i)
+    {
+        auto direction = Core2048::GameCore::Direction(i % 4);
+        auto core      = *cores[i % k_cores_count];
+        auto seed      = core;
+        auto cells     = core;
+
+        Core2048::GameRecordWriter seed_writer (&seed_stream,  Spawns::Seed );
+        Core2048::GameRecordWriter cells_writer(&cells_stream, Spawns::Cells);
+        seed_writer .begin(&seed );
+        cells_writer.begin(&cells);
+
+        for(auto p_core : { &core, &seed, &cells })
+        {
+            auto first = Core2048::GameCore::Direction((i + 1) % 4);
+            while(!p_core->is_valid_move(first))
+                first = Core2048::GameCore::Direction((int(first) + 1) % 4);
+
+            p_core->make_move(first);
+            p_core->generate_next_block();
+        }
+
+        if(core.is_valid_move(direction))
+        {
+            measure(m_off, [&]() {
+                core.make_move(direction);
+                core.generate_next_block();
+            });
+            measure(m_seed, [&]() {
+                seed.make_move(direction);
+                seed.generate_next_block();
+            });
+            measure(m_cells, [&]() {
+                cells.make_move(direction);
+                cells.generate_next_block();
+            });
+        }
+
+        seed_writer .end();
+        cells_writer.end();
+        seed_stream .str("");
+        cells_stream.str("");
+    }
+
+    if(should_run(name_off  )) report(name_off,   m_off  );
+    if(should_run(name_seed )) report(name_seed,  m_seed );
+    if(should_run(name_cells)) report(name_cells, m_cells);
+}
+
+// Fills half of a fresh 4x4 board, only the generate_next_block() calls
+// are timed. The GameCore goes through IValuesGenerator, the StaticGameCore
+// has the table of the values file built at compile time.
+template <typename Core>
+void
+bench_spawn(const char *p_variant, const Core &fresh_core, u32 ops_count)
+    noexcept
+{
+    auto name = std::string("spawn/") + p_variant;
+    if(!should_run(name))
+        return;
+
+    auto m = Measure{0, 0, 0};
+    for(auto i = 0u; i < ops_count / 8; ++i)
+    {
+        auto core = fresh_core;
+        measure(m, [&]() {
+            for(auto j = 0; j < 8; ++j)
+                core.generate_next_block();
+        });
+    }
+
+    m.ops_count *= 8;
+    report(name, m);
+}
+
+// Draws numbers in [0, 15] one by one and, for the CounterRandom, in
+// batches of 256 with fill(). The CountedRandom is the Core2048::Random
+// of the default build.
+volatile i64 g_random_sink = 0;
+
+void
+bench_random(u32 ops_count) noexcept
+{
+    constexpr auto k_batch_size = 256u;
+
+    auto sum = i64(0);
+    if(should_run("random/core_random"))
+    {
+        auto random = CoreRandom::Random(1);
+        auto m      = Measure{0, 0, 0};
+
+        measure(m, [&]() {
+            for(auto i = 0u; i < ops_count; ++i)
+                sum += random.next(0, 15);
+        });
+
+        m.ops_count = ops_count;
+        report("random/core_random", m);
+    }
+
+    if(should_run("random/counted_random"))
+    {
+        auto random = Core2048::CountedRandom(1);
+        auto m      = Measure{0, 0, 0};
+
+        measure(m, [&]() {
+            for(auto i = 0u; i < ops_count; ++i)
+                sum += random.next(0, 15);
+        });
+
+        m.ops_count = ops_count;
+        report("random/counted_random", m);
+    }
+
+    if(should_run("random/counter_random"))
+    {
+        auto random = Core2048::CounterRandom(1);
+        auto m      = Measure{0, 0, 0};
+
+        measure(m, [&]() {
+            for(auto i = 0u; i < ops_count; ++i)
+                sum += random.next(0, 15);
+        });
+
+        m.ops_count = ops_count;
+        report("random/counter_random", m);
+    }
+
+    if(should_run("random/counter_random_fill"))
+    {
+        auto random = Core2048::CounterRandom(1);
+        auto m      = Measure{0, 0, 0};
+        i32  values[k_batch_size];
+
+        measure(m, [&]() {
+            for(auto i = 0u; i < ops_count; i += k_batch_size)
+            {
+                random.fill(values, k_batch_size, 0, 15);
+                sum += values[(i / k_batch_size) % k_batch_size];
+            }
+        });
+
+        m.ops_count = ops_count;
+        report("random/counter_random_fill", m);
+    }
+
+    // Keeps the numbers from being optimized away.
+    g_random_sink = sum;
+}
+
+// Makes a single move on copies of size x size boards that are 90% full,
+// so every move does about a merge per each pair of blocks.
+// Only the make_move() is timed.
+void
+bench_move_scaling(
+    u32                            size,
+    u32                            moves_count,
+    Core2048::GameCore::MoveEngine engine,
+    const char                    *p_engine_name) noexcept
+{
+    if(!should_run(std::string("move_scaling/") + p_engine_name))
+        return;
+
+    constexpr auto k_boards_count = 8;
+
+    auto values_gen = BenchValuesGenerator();
+    auto boards     = std::vector<std::unique_ptr<Core2048::GameCore>>();
+    for(auto i = 0; i < k_boards_count; ++i)
+    {
+        boards.push_back(create_filled_core(&values_gen, size, i, 0.9f));
+        boards.back()->set_move_engine(engine);
+    }
+
+    auto total_ns     = 0.0;
+    auto merges_count = 0u;
+
+    for(auto i = 0u; i < moves_count; ++i)
+    {
+        auto core = *boards[i % k_boards_count];
+        auto dir  = Core2048::GameCore::Direction((i / k_boards_count) % 4);
+
+        auto  start  = Clock::now();
+        auto &result = core.make_move(dir);
+        total_ns += elapsed_ns(start);
+
+        merges_count += result.merged_blocks.size();
+    }
+
+    printf(
+        "move_scaling/%s/%ux%u \t%12.1f ns/op \t%8.1f ns/cell"
+        " \t%6.1f merges/op\n",
+        p_engine_name,
+        size,
+        size,
+        total_ns / moves_count,
+        total_ns / moves_count / (size * size),
+        double(merges_count) / moves_count
+    );
+}
+
+
+// The horizontal and the vertical moves of the same boards, tall boards
+// have few long columns and many short rows, wide boards the opposite.
+void
+bench_move_axes(u32 width, u32 height, u32 moves_count) noexcept
+{
+    if(!should_run("move_axes"))
+        return;
+
+    constexpr auto k_boards_count = 8;
+
+    auto values_gen = BenchValuesGenerator();
+    auto boards     = std::vector<Core2048::GameCore>();
+    for(auto i = 0; i < k_boards_count; ++i)
+    {
+        boards.emplace_back(&values_gen, width, height, i);
+
+        // The core already generated the first block.
+        auto blocks_count = u32(width * height * 0.9f);
+        for(auto j = 1u; j < blocks_count; ++j)
+            boards.back().generate_next_block();
+    }
+
+    double total_ns[2] = { 0.0, 0.0 }; // Horizontal, Vertical.
+    for(auto i = 0u; i < moves_count; ++i)
+    {
+        auto core = boards[i % k_boards_count];
+        auto dir  = Core2048::GameCore::Direction((i / k_boards_count) % 4);
+        auto axis = (dir == Core2048::GameCore::Direction::Left ||
+                     dir == Core2048::GameCore::Direction::Right) ? 0 : 1;
+
+        auto start = Clock::now();
+        core.make_move(dir);
+        total_ns[axis] += elapsed_ns(start);
+    }
+
+    printf(
+        "move_axes/%ux%u \t%12.1f ns/horizontal \t%12.1f ns/vertical\n",
+        width,
+        height,
+        total_ns[0] / (moves_count / 2),
+        total_ns[1] / (moves_count / 2)
+    );
+}
+
+// Moves random lines of 64 cells, about 70% of them non empty.
+void
+bench_line_kernel(
+    Core2048::LineKernel::Isa isa,
+    const char               *p_isa_name,
+    u32                       moves_count) noexcept
+{
+    if(!should_run(std::string("line_kernel/") + p_isa_name))
+        return;
+
+    if(!Core2048::LineKernel::is_isa_supported(isa))
+    {
+        printf("line_kernel/%s \tnot supported\n", p_isa_name);
+        return;
+    }
+
+    constexpr auto k_lines_count = 256;
+    constexpr auto k_line_size   = Core2048::LineKernel::k_max_line_size;
+
+    auto random = Core2048::Random(1);
+    auto lines  = std::vector<u8>(k_lines_count * k_line_size);
+    for(auto &cell : lines)
+        cell = (random.next(0, 9) < 7) ? u8(random.next(1, 3)) : 0;
+
+    auto transition = Core2048::LineKernel::Transition();
+    auto checksum   = u64(0);
+    auto start      = Clock::now();
+
+    for(auto i = 0u; i < moves_count; ++i)
+    {
+        auto p_line = &lines[(i % k_lines_count) * k_line_size];
+        Core2048::LineKernel::move_line(isa, p_line, &transition);
+
+        checksum += transition.merged_mask;
+    }
+
+    auto ns = elapsed_ns(start);
+    printf(
+        "line_kernel/%s \t%12.1f ns/op \t(%llx)\n",
+        p_isa_name,
+        ns / moves_count,
+        (unsigned long long)(checksum & 0xFF)
+    );
+}
+
+//
+void
+bench_batch_simulator(
+    Core2048::BatchSimulator::Policy policy,
+    const char                      *p_policy_name,
+    u32                              games_count,
+    Core2048::ThreadPool            *p_pool) noexcept
+{
+    if(!should_run(std::string("batch_simulator/") + p_policy_name))
+        return;
+
+    auto generator = BenchValuesGenerator();
+    auto simulator = Core2048::BatchSimulator(&generator);
+    simulator.set_policy     (policy);
+    simulator.set_thread_pool(p_pool);
+
+    auto start = Clock::now();
+    auto stats = simulator.run(games_count, 1);
+    auto ns    = elapsed_ns(start);
+
+    printf(
+        "batch_simulator/%s/%u threads \t%12.1f ns/move"
+        " \t%8.2f Mmoves/s \t%6.1f moves/game\n",
+        p_policy_name,
+        (p_pool) ? p_pool->get_threads_count() : 1,
+        ns / stats.moves_count,
+        stats.moves_count / ns * 1000.0,
+        double(stats.moves_count) / games_count
+    );
+}
+
+// Plays games of random valid moves, that are verified in the timing.
+// The first game of every 4 claims a wrong score, so the batches
+// aren't all valid ones.
+void
+bench_replay_verifier(
+    u32                   size,
+    u32                   games_count,
+    Core2048::ThreadPool *p_pool) noexcept
+{
+    if(!should_run("replay_verifier/" + std::to_string(size)))
+        return;
+
+    auto values_gen = BenchValuesGenerator();
+    auto games      = std::vector<Core2048::ReplayVerifier::Game>();
+    games.reserve(games_count);
+
+    for(auto seed = 0u; seed < games_count; ++seed)
+    {
+        auto core = Core2048::GameCore(&values_gen, size, size, seed);
+        auto game = Core2048::ReplayVerifier::Game {
+            i32(seed), size, size, 1, {}, 0, 0, 0
+        };
+
+        auto random = Core2048::Random(seed);
+        while(core.get_status() == CoreGame::Status::Continue)
+        {
+            auto direction = Core2048::GameCore::Direction(random.next(0, 3));
+            if(!core.is_valid_move(direction))
+                continue;
+
+            core.make_move(direction);
+            core.generate_next_block();
+
+            if(game.moves_count % 4 == 0)
+                game.moves.push_back(0);
+
+            auto shift = game.moves_count % 4 * 2;
+            game.moves.back() |= u8(u32(direction) << shift);
+            ++game.moves_count;
+            ++game.blocks_count;
+        }
+
+        game.claimed_score = core.get_score() + ((seed % 4 == 0) ? 2 : 0);
+        games.push_back(std::move(game));
+    }
+
+    auto verifier = Core2048::ReplayVerifier([]() {
+        return std::make_shared<BenchValuesGenerator>();
+    });
+    verifier.set_thread_pool(p_pool);
+
+    auto results  = std::vector<Core2048::ReplayVerifier::Result>();
+    auto counters = verifier.verify(games, &results);
+
+    printf(
+        "replay_verifier/%ux%u/%u threads \t%12.1f ns/game"
+        " \t%8.2f Mmoves/s \t%8.0f games/s\n",
+        size,
+        size,
+        (p_pool) ? p_pool->get_threads_count() : 1,
+        counters.seconds * 1e9 / counters.games_count,
+        counters.moves_per_second / 1e6,
+        counters.games_per_second
+    );
+}
+
+// An in-process load of players, each round every session sends a move
+// and the finished games are closed and replaced by new ones.
+void
+bench_session_host(
+    u32                   sessions_count,
+    u32                   rounds_count,
+    Core2048::ThreadPool *p_pool) noexcept
+{
+    if(!should_run("session_host"))
+        return;
+
+    typedef Core2048::SessionHost SessionHost;
+
+    SessionHost host([]() {
+        return std::make_shared<BenchValuesGenerator>();
+    });
+    host.set_thread_pool(p_pool);
+
+    auto seed     = 0;
+    auto sessions = std::vector<SessionHost::SessionId>();
+    for(auto i = 0u; i < sessions_count; ++i)
+        sessions.push_back(host.create(4, 4, seed++));
+
+    auto random   = Core2048::Random(0);
+    auto moves    = std::vector<SessionHost::Move>(sessions_count);
+    auto outcomes = std::vector<SessionHost::MoveOutcome>();
+    auto snapshot = Core2048::GameCore::Snapshot();
+
+    auto total_ns     = 0.0;
+    auto closed_count = 0u;
+
+    for(auto round = 0u; round < rounds_count; ++round)
+    {
+        for(auto i = 0u; i < sessions_count; ++i)
+        {
+            moves[i].session_id = sessions[i];
+            moves[i].direction  =
+                Core2048::GameCore::Direction(random.next(0, 3));
+        }
+
+        auto start = Clock::now();
+        host.apply_moves(moves, &outcomes);
+        total_ns += elapsed_ns(start);
+
+        for(auto i = 0u; i < sessions_count; ++i)
+        {
+            if(outcomes[i].status == CoreGame::Status::Continue)
+                continue;
+
+            host.snapshot(sessions[i], &snapshot);
+            host.close   (sessions[i]);
+
+            sessions[i] = host.create(4, 4, seed++);
+            ++closed_count;
+        }
+    }
+
+    auto moves_count = f64(sessions_count) * rounds_count;
+    printf(
+        "session_host/%u sessions/%u threads \t%12.1f ns/move"
+        " \t%8.2f Mmoves/s \t%8u closed\n",
+        sessions_count,
+        (p_pool) ? p_pool->get_threads_count() : 1,
+        total_ns / moves_count,
+        moves_count / total_ns * 1e3,
+        closed_count
+    );
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+// Usage: Core2048_bench [filter] [values_file]
+//   filter      - Only benchmarks with it in theirs names are run.
+//   values_file - The values of PresetValuesGenerator benchmarks,
+//                 default is resources/values.txt.
+int
+main(int argc, const char *argv[])
+{
+    typedef Core2048::GameCore::Direction  Direction;
+    typedef Core2048::GameCore::MoveEngine MoveEngine;
+    typedef Core2048::LineKernel::Isa      Isa;
+
+    g_filter         = (argc > 1) ? argv[1] : "";
+    auto values_file = (argc > 2) ? argv[2] : "resources/values.txt";
+
+    const u32 sizes      [] = { 4, 8, 16 };
+    const f32 fill_ratios[] = { 0.25f, 0.5f, 0.9f };
+
+    for(auto size : sizes)
+    {
+        auto ops_count = 200000 / (size * size) * 16;
+        for(auto fill_ratio : fill_ratios)
+        {
+            for(auto i = 0; i < 4; ++i)
+            {
+                auto dir = Direction(i);
+                bench_make_move    (dir, size, fill_ratio, ops_count);
+                bench_is_valid_move(dir, size, fill_ratio, ops_count);
+
+                if(size != Core2048::BitBoard::k_size)
+                    continue;
+
+                bench_bitboard_make_move    (dir, fill_ratio, ops_count);
+                bench_bitboard_is_valid_move(dir, fill_ratio, ops_count);
+            }
+        }
+
+        bench_check_status       (size,    ops_count);
+        bench_generate_next_block(size, 1, ops_count);
+        bench_generate_next_block(size, 4, ops_count);
+        bench_journal            (size,    ops_count);
+        bench_clone              (size,    ops_count);
+        bench_arena              (size,    ops_count / 4);
+        bench_record             (size,    ops_count);
+    }
+
+    bench_preset_values_generator(values_file, 1000000);
+    bench_random(10000000);
+
+    if(std::ifstream(values_file).good())
+    {
+        typedef Core2048::StaticValuesGenerator<Core2048::DefaultValuesTable>
+            StaticGenerator;
+
+        auto generator   = Core2048::PresetValuesGenerator(values_file);
+        auto preset      = Core2048::GameCore(&generator, 4, 4, 1);
+        auto static_core = Core2048::StaticGameCore<StaticGenerator>(4, 4, 1);
+
+        bench_spawn("preset", preset,      1000000);
+        bench_spawn("static", static_core, 1000000);
+    }
+
+    bench_move_scaling(  4, 100000, MoveEngine::Scan,       "scan");
+    bench_move_scaling(  8,  50000, MoveEngine::Scan,       "scan");
+    bench_move_scaling( 16,  10000, MoveEngine::Scan,       "scan");
+    bench_move_scaling( 32,   2000, MoveEngine::Scan,       "scan");
+    bench_move_scaling( 64,    400, MoveEngine::Scan,       "scan");
+    bench_move_scaling(128,    100, MoveEngine::Scan,       "scan");
+    bench_move_scaling(  8,  50000, MoveEngine::LineKernel, "kernel");
+    bench_move_scaling( 16,  10000, MoveEngine::LineKernel, "kernel");
+    bench_move_scaling( 32,   2000, MoveEngine::LineKernel, "kernel");
+    bench_move_scaling( 64,    400, MoveEngine::LineKernel, "kernel");
+
+    bench_move_axes(  8, 128, 2000);
+    bench_move_axes(128,   8, 2000);
+    bench_move_axes( 16, 512,  200);
+
+    bench_line_kernel(Isa::Scalar, "scalar", 1000000);
+    bench_line_kernel(Isa::SSE41,  "sse4.1", 1000000);
+    bench_line_kernel(Isa::AVX2,   "avx2",   1000000);
+
+    Core2048::ThreadPool pool;
+    bench_batch_simulator(Core2048::BatchSimulator::Policy::Random, "random",
+                          100000, nullptr);
+    bench_batch_simulator(Core2048::BatchSimulator::Policy::Random, "random",
+                          100000, &pool);
+    bench_batch_simulator(Core2048::BatchSimulator::Policy::Greedy, "greedy",
+                          100000, &pool);
+    bench_batch_simulator(Core2048::BatchSimulator::Policy::Corner, "corner",
+                          100000, &pool);
+
+    bench_replay_verifier(4, 20000, nullptr);
+    bench_replay_verifier(4, 20000, &pool);
+    bench_replay_verifier(6,  1000, &pool);
+
+    bench_session_host(10000, 200, nullptr);
+    bench_session_host(10000, 200, &pool);
+}
@@ -34,16 +34,18 @@
 
 void
 print_board(
-    const Core2048::GameCore::Board &board,
-    Core2048::Block::SPtr           p_gen_block) noexcept
+    const Core2048::GameCore &core,
+    const Core2048::Block    *p_gen_block) noexcept
 {
     //    system("tput clear");
-    for(auto &line : board)
+    for(auto &line : core.get_board())
     {
-        for(auto p_block : line)
+        for(auto handle : line)
         {
-            if(p_block)
+            if(handle != Core2048::Block::k_invalid_handle)
             {
+                auto p_block = &core.get_block(handle);
+
                 std::stringstream ss;
                 ss << p_block->get_value();
 
@@ -96,10 +98,10 @@ main()
     std::string input = "";
     int input_i = 0;
 
-    auto p_block = core.generate_next_block();
+    auto p_block = &core.generate_next_block();
     while(1)
     {
-        print_board(core.get_board(), p_block);
+        print_board(core, p_block);
         std::cout << ss.str() << std::endl;
         std::cout << "Dir: ";
 
@@ -123,19 +125,19 @@ main()
             auto a = core.make_move(dir);
             if(a.moved_blocks.size() != 0)
             {
-                auto old_coord = a.moved_blocks[0]->get_old_coord();
-                auto coord     = a.moved_blocks[0]->get_coord    ();
+                auto &event = a.moved_blocks[0];
+                auto  width = core.get_width();
 
                 printf(
                     "(%d,%d)\n(%d,%d)\n",
-                    old_coord.y,
-                    old_coord.x,
-                    coord.y,
-                    coord.x
+                    event.from / width,
+                    event.from % width,
+                    event.to   / width,
+                    event.to   % width
                 );
             }
 
-            p_block = core.generate_next_block();
+            p_block = &core.generate_next_block();
         }
     }
 }
@@ -0,0 +1,74 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : TestUtils.h                                                   //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Helpers shared by the Core2048 tests.                                   //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+#pragma once
+// std
+#include <cstdio>
+// Core2048
+#include "Core2048/Core2048.h"
+
+
+//----------------------------------------------------------------------------//
+// Checks                                                                     //
+//----------------------------------------------------------------------------//
+// The failed checks are counted and the first ones are printed,
+// tests return get_failures_count() != 0 from main().
+inline u32&
+get_failures_count() noexcept
+{
+    static u32 s_failures_count = 0;
+    return s_failures_count;
+}
+
+#define TEST_CHECK(_cond_)                                                    \
+    do {                                                                      \
+        if(!(_cond_) && get_failures_count()++ < 20)                          \
+            printf("%s:%d: FAILED %s\n", __FILE__, __LINE__, #_cond_);        \
+    } while(0)
+
+
+//----------------------------------------------------------------------------//
+// Values Generator                                                           //
+//----------------------------------------------------------------------------//
+// The classic 2 (90%) / 4 (10%) split, the tests don't depend on
+// the values tables of the resources.
+class TestValuesGenerator
+    : public Core2048::IValuesGenerator
+{
+public:
+    virtual u32
+    generate_value(Core2048::Random &rnd_gen) noexcept override
+    {
+        return (rnd_gen.next(0, 9) == 0) ? 4 : 2;
+    }
+
+    virtual void
+    set_max_value(u32 /* value */) noexcept override
+    {
+        // Empty...
+    }
+
+    virtual ValuesChances
+    get_values_chances() const noexcept override
+    {
+        return { {2, 0.9f}, {4, 0.1f} };
+    }
+};
@@ -0,0 +1,121 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Replays random games on a BitBoardGameCore and a GameCore.              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_games_count     = 2000;
+constexpr auto k_max_moves_count = 5000;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// Both cores have the same rules and draw the same random numbers,
+// so they must play the same boards.
+void
+check_same_game(const BitBoardGameCore &bit_core, const GameCore &core)
+    noexcept
+{
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(BitBoard::k_size); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(BitBoard::k_size); ++coord.x)
+        {
+            auto p_block = core.get_block_at(coord);
+            auto value   = (p_block) ? p_block->get_value() : 0;
+
+            TEST_CHECK(bit_core.get_value_at(coord) == value);
+        }
+    }
+
+    TEST_CHECK(bit_core.get_score      () == core.get_score      ());
+    TEST_CHECK(bit_core.get_max_value  () == core.get_max_value  ());
+    TEST_CHECK(bit_core.get_moves_count() == core.get_moves_count());
+    TEST_CHECK(bit_core.get_status     () == core.get_status     ());
+}
+
+void
+replay_game(i32 seed) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    auto bit_core   = BitBoardGameCore(&values_gen, seed);
+    auto core       = GameCore(&values_gen, 4, 4, seed);
+    auto random     = Random(seed);
+
+    check_same_game(bit_core, core);
+    for(auto i = 0; i < k_max_moves_count; ++i)
+    {
+        if(core.get_status() == CoreGame::Status::Defeat)
+            break;
+
+        for(auto d = 0; d < 4; ++d)
+        {
+            auto direction = GameCore::Direction(d);
+            TEST_CHECK(
+                bit_core.is_valid_move(direction) ==
+                core    .is_valid_move(direction)
+            );
+        }
+
+        auto direction = GameCore::Direction(random.next(0, 3));
+        auto bit_moved = bit_core.make_move(direction);
+        auto moved     = core.make_move(direction).move_valid;
+
+        TEST_CHECK(bit_moved == moved);
+        if(moved)
+        {
+            bit_core.generate_next_block();
+            core    .generate_next_block();
+        }
+
+        check_same_game(bit_core, core);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    for(auto seed = 0; seed < k_games_count; ++seed)
+        replay_game(seed);
+
+    printf(
+        "bitboard_replay: %d games, %u failures\n",
+        k_games_count,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,186 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that the CounterRandom splits and fills are reproducible.        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <algorithm>
+#include <cstdio>
+#include <unordered_set>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_seeds_count   = 200;
+constexpr auto k_numbers_count = 1000u;
+constexpr auto k_streams_count = 200000u;
+
+const i32 k_ranges[][2] = {
+    { 0, 1 }, { 0, 3 }, { 0, 9 }, { -5, 5 }, { 0, 0x7FFFFFFF }
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+std::vector<i32>
+draw(CounterRandom random, u32 count, i32 min, i32 max) noexcept
+{
+    auto values = std::vector<i32>(count);
+    for(auto &value : values)
+        value = random.next(min, max);
+
+    return values;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// The same (seed, stream) gives the same split, and the seed of a split
+// alone gives its numbers, that's how the games are replayed.
+void
+test_split() noexcept
+{
+    for(auto seed = 0; seed < k_seeds_count; ++seed)
+    {
+        auto random = CounterRandom(seed);
+        for(auto stream = u64(0); stream < 8; ++stream)
+        {
+            auto split = random.split(stream);
+            auto again = CounterRandom(seed).split(stream);
+            auto other = CounterRandom(split.getSeed());
+
+            TEST_CHECK(split.getSeed() >= 0);
+            TEST_CHECK(split.getSeed() == again.getSeed());
+            TEST_CHECK(split.get_counter() == 0);
+
+            auto numbers = draw(split, k_numbers_count, 0, 9);
+            TEST_CHECK(numbers == draw(again, k_numbers_count, 0, 9));
+            TEST_CHECK(numbers == draw(other, k_numbers_count, 0, 9));
+
+            // Splits of splits.
+            auto inner = split.split(stream);
+            TEST_CHECK(inner.getSeed() == again.split(stream).getSeed());
+            TEST_CHECK(inner.getSeed() != split.getSeed());
+        }
+
+        // Drawing doesn't change the splits.
+        auto drawn = random;
+        drawn.next();
+        TEST_CHECK(drawn.split(3).getSeed() == random.split(3).getSeed());
+    }
+}
+
+// The streams of a generator never share a seed.
+void
+test_split_seeds() noexcept
+{
+    auto random = CounterRandom(7);
+    auto seeds  = std::unordered_set<i32>();
+    for(auto stream = u64(0); stream < k_streams_count; ++stream)
+        seeds.insert(random.split(stream).getSeed());
+
+    TEST_CHECK(seeds.size() == k_streams_count);
+}
+
+// fill() gives the numbers of the calls to next() and skips them.
+void
+test_fill() noexcept
+{
+    auto values = std::vector<i32>(k_numbers_count);
+    for(auto seed = 0; seed < k_seeds_count; ++seed)
+    {
+        for(auto &range : k_ranges)
+        {
+            auto random = CounterRandom(seed);
+            auto count  = u32(seed) % k_numbers_count;
+
+            random.next();
+            auto numbers = draw(random, count + 1, range[0], range[1]);
+
+            random.fill(values.data(), count, range[0], range[1]);
+            TEST_CHECK(random.get_counter() == count + 1);
+            TEST_CHECK(std::equal(
+                values.begin(), values.begin() + count, numbers.begin()
+            ));
+            TEST_CHECK(random.next(range[0], range[1]) == numbers[count]);
+
+            for(auto i = 0u; i < count; ++i)
+            {
+                TEST_CHECK(values[i] >= range[0]);
+                TEST_CHECK(values[i] <= range[1]);
+            }
+        }
+    }
+}
+
+// Going to a counter, back or forward, gives the numbers from there.
+void
+test_counter() noexcept
+{
+    for(auto seed = 0; seed < k_seeds_count; ++seed)
+    {
+        auto random  = CounterRandom(seed);
+        auto numbers = draw(random, k_numbers_count, 0, 99);
+        auto counter = u64(seed) * 5 % k_numbers_count;
+
+        random.set_counter(counter);
+        for(auto i = counter; i < k_numbers_count; ++i)
+            TEST_CHECK(random.next(0, 99) == numbers[i]);
+
+        random.set_counter(0);
+        auto state = random.get_state();
+        TEST_CHECK(draw(random, k_numbers_count, 0, 99) == numbers);
+
+        random.next();
+        random.set_state(state);
+        TEST_CHECK(random.get_counter() == 0);
+        TEST_CHECK(random.next(0, 99) == numbers[0]);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    test_split      ();
+    test_split_seeds();
+    test_fill       ();
+    test_counter    ();
+
+    printf(
+        "counter_random: %d seeds, %u failures\n",
+        k_seeds_count,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
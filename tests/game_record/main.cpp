@@ -0,0 +1,330 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that the records replay their games and reject broken bytes.     //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+#include <string>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_games_count         = 30;
+constexpr auto k_damaged_games_count = 3;
+constexpr auto k_max_moves_count     = 6000;
+
+const u32 k_sizes[][2] = { { 4, 4 }, { 5, 3 }, { 8, 8 } };
+
+const GameRecord::Spawns k_spawns[] = {
+    GameRecord::Spawns::Seed, GameRecord::Spawns::Cells
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// What the players see of a game.
+struct GameState
+{
+    std::vector<u32> values;
+
+    u32              score;
+    u32              max_value;
+    u32              moves_count;
+    u64              hash;
+    CoreGame::Status status;
+
+    bool
+    operator==(const GameState &other) const noexcept
+    {
+        return values      == other.values
+            && score       == other.score
+            && max_value   == other.max_value
+            && moves_count == other.moves_count
+            && hash        == other.hash
+            && status      == other.status;
+    }
+};
+
+GameState
+get_state(const GameCore &game) noexcept
+{
+    auto state = GameState{
+        {},
+        game.get_score      (),
+        game.get_max_value  (),
+        game.get_moves_count(),
+        game.get_hash       (),
+        game.get_status     ()
+    };
+
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(game.get_height()); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(game.get_width()); ++coord.x)
+        {
+            auto p_block = game.get_block_at(coord);
+            state.values.push_back((p_block) ? p_block->get_value() : 0);
+        }
+    }
+
+    return state;
+}
+
+// A recorded game with random valid moves until the defeat.
+struct RecordedGame
+{
+    std::string                      bytes;
+    std::vector<GameCore::Direction> directions;
+    GameState                        state;
+};
+
+RecordedGame
+record_game(
+    IValuesGenerator   *p_values_gen,
+    u32                 width,
+    u32                 height,
+    i32                 seed,
+    GameRecord::Spawns  spawns) noexcept
+{
+    auto game   = GameCore(p_values_gen, width, height, seed);
+    auto random = Random(seed);
+    auto record = RecordedGame();
+
+    std::ostringstream stream(std::ios::binary);
+    GameRecordWriter   writer(&stream, spawns, u64(seed));
+    writer.begin(&game);
+
+    for(auto i = 0; i < k_max_moves_count; ++i)
+    {
+        if(game.get_status() == CoreGame::Status::Defeat)
+            break;
+
+        auto direction = GameCore::Direction(random.next(0, 3));
+        if(!game.make_move(direction).move_valid)
+            continue;
+
+        game.generate_next_block();
+        record.directions.push_back(direction);
+    }
+
+    TEST_CHECK(writer.end());
+
+    record.bytes = stream.str();
+    record.state = get_state(game);
+    return record;
+}
+
+// Replays the bytes on a new game, true if the whole record was replayed.
+bool
+replay(
+    IValuesGenerator  *p_values_gen,
+    const std::string &bytes,
+    u32                width,
+    u32                height,
+    i32                seed,
+    GameState         *p_state = nullptr) noexcept
+{
+    std::istringstream stream(bytes, std::ios::binary);
+    GameRecordReader   reader(&stream);
+
+    auto game     = GameCore(p_values_gen, width, height, seed);
+    auto replayed = reader.replay(&game) && reader.is_complete();
+
+    if(p_state)
+        *p_state = get_state(game);
+
+    return replayed;
+}
+
+// Sets the checksum of the footer again, for records changed on purpose.
+void
+update_checksum(std::string *p_bytes) noexcept
+{
+    auto size     = p_bytes->size() - sizeof(u32);
+    auto checksum = GameRecord::update_checksum(
+        GameRecord::get_empty_checksum(), p_bytes->data(), size
+    );
+
+    memcpy(&(*p_bytes)[size], &checksum, sizeof(checksum));
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// The turns read back are the ones played, and the replays end on the
+// state of the recorded game.
+void
+test_round_trip(u32 width, u32 height, GameRecord::Spawns spawns) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto record = record_game(&values_gen, width, height, seed, spawns);
+
+        //----------------------------------------------------------------------
+        // The turns.
+        std::istringstream stream(record.bytes, std::ios::binary);
+        GameRecordReader   reader(&stream);
+
+        auto &header = reader.get_header();
+        TEST_CHECK(reader.is_valid());
+        TEST_CHECK(header.spawns  == spawns);
+        TEST_CHECK(header.random  == GameRecord::k_random);
+        TEST_CHECK(header.seed    == seed);
+        TEST_CHECK(header.game_id == u64(seed));
+
+        auto turn        = GameRecordReader::Turn();
+        auto turns_count = 0u;
+        while(reader.read_turn(&turn))
+        {
+            TEST_CHECK(turns_count < record.directions.size());
+            if(turns_count < record.directions.size())
+                TEST_CHECK(turn.direction == record.directions[turns_count]);
+
+            // A block after each move.
+            if(spawns == GameRecord::Spawns::Cells)
+                TEST_CHECK(turn.blocks.size() == 1);
+
+            ++turns_count;
+        }
+
+        TEST_CHECK(reader.is_complete());
+        TEST_CHECK(reader.get_size() == record.bytes.size());
+        TEST_CHECK(turns_count == record.directions.size());
+        TEST_CHECK(reader.get_footer().score == record.state.score);
+
+        //----------------------------------------------------------------------
+        // The replays, the cells records on a game of another seed too.
+        auto state = GameState();
+        TEST_CHECK(replay(
+            &values_gen, record.bytes, width, height, seed, &state
+        ));
+        TEST_CHECK(state == record.state);
+
+        if(spawns == GameRecord::Spawns::Cells)
+        {
+            TEST_CHECK(replay(
+                &values_gen, record.bytes, width, height, seed + 1, &state
+            ));
+            TEST_CHECK(state == record.state);
+        }
+        else
+        {
+            TEST_CHECK(!replay(
+                &values_gen, record.bytes, width, height, seed + 1
+            ));
+        }
+    }
+}
+
+// Any flipped byte and any truncation make the record fail.
+void
+test_damaged(u32 width, u32 height, GameRecord::Spawns spawns) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_damaged_games_count; ++seed)
+    {
+        auto record = record_game(&values_gen, width, height, seed, spawns);
+        auto bytes  = record.bytes;
+
+        for(auto i = size_t(0); i < bytes.size(); ++i)
+        {
+            bytes[i] ^= char(1 << (i % 8));
+            TEST_CHECK(!replay(&values_gen, bytes, width, height, seed));
+            bytes[i] = record.bytes[i];
+        }
+
+        for(auto size = size_t(0); size < bytes.size(); ++size)
+        {
+            auto truncated = bytes.substr(0, size);
+            TEST_CHECK(!replay(&values_gen, truncated, width, height, seed));
+        }
+    }
+}
+
+// The seed records of the other Random give other games, so they're
+// rejected, the cells records give the same game with any of them.
+void
+test_other_random(GameRecord::Spawns spawns) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_damaged_games_count; ++seed)
+    {
+        auto record = record_game(&values_gen, 4, 4, seed, spawns);
+        auto other  = (GameRecord::k_random == GameRecord::Randoms::Counted)
+            ? GameRecord::Randoms::Counter
+            : GameRecord::Randoms::Counted;
+
+        auto bytes = record.bytes;
+        memcpy(
+            &bytes[offsetof(GameRecord::Header, random)],
+            &other,
+            sizeof(other)
+        );
+        update_checksum(&bytes);
+
+        std::istringstream stream(bytes, std::ios::binary);
+        GameRecordReader   reader(&stream);
+
+        auto is_seed = (spawns == GameRecord::Spawns::Seed);
+        TEST_CHECK(reader.is_valid() == !is_seed);
+        TEST_CHECK(replay(&values_gen, bytes, 4, 4, seed) == !is_seed);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    for(auto spawns : k_spawns)
+    {
+        for(auto &size : k_sizes)
+            test_round_trip(size[0], size[1], spawns);
+
+        test_damaged(4, 4, spawns);
+        test_damaged(5, 3, spawns);
+
+        test_other_random(spawns);
+    }
+
+    printf(
+        "game_record: %d games, %u failures\n",
+        (k_games_count * 3 + k_damaged_games_count * 3) * 2,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,251 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that undo() and redo() give back the exact states.               //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_games_count       = 40;
+constexpr auto k_max_turns_count   = 500;
+constexpr auto k_journal_capacity  = 30u;
+
+const u32 k_sizes[][2] = { { 4, 4 }, { 5, 3 }, { 8, 8 }, { 3, 17 } };
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// What the players see of a game.
+struct GameState
+{
+    std::vector<u32> values;
+
+    u32              score;
+    u32              max_value;
+    u32              moves_count;
+    u64              hash;
+    CoreGame::Status status;
+    u32              empty_cells_count;
+
+    bool
+    operator==(const GameState &other) const noexcept
+    {
+        return values            == other.values
+            && score             == other.score
+            && max_value         == other.max_value
+            && moves_count       == other.moves_count
+            && hash              == other.hash
+            && status            == other.status
+            && empty_cells_count == other.empty_cells_count;
+    }
+};
+
+GameState
+get_state(const GameCore &game) noexcept
+{
+    auto state = GameState{
+        {},
+        game.get_score            (),
+        game.get_max_value        (),
+        game.get_moves_count      (),
+        game.get_hash             (),
+        game.get_status           (),
+        game.get_empty_cells_count()
+    };
+
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(game.get_height()); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(game.get_width()); ++coord.x)
+        {
+            auto p_block = game.get_block_at(coord);
+            state.values.push_back((p_block) ? p_block->get_value() : 0);
+        }
+    }
+
+    return state;
+}
+
+// Makes a random valid move and its block, false if there's none.
+bool
+play_turn(GameCore &game, Random &random) noexcept
+{
+    for(auto i = 0; i < 16; ++i)
+    {
+        auto direction = GameCore::Direction(random.next(0, 3));
+        if(!game.make_move(direction).move_valid)
+            continue;
+
+        game.generate_next_block();
+        return true;
+    }
+
+    return false;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// Turns, undos and redos at random, each state is checked against the
+// ones the game went through.
+void
+test_undo_redo(u32 width, u32 height, GameCore::MoveEngine engine) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto game = GameCore(&values_gen, width, height, seed);
+        game.set_move_engine     (engine);
+        game.set_journal_capacity(k_journal_capacity);
+
+        auto random = Random(seed);
+        auto states = std::vector<GameState>{ get_state(game) };
+        auto redos  = std::vector<GameState>();
+
+        for(auto turn = 0; turn < k_max_turns_count; ++turn)
+        {
+            auto action = random.next(0, 9);
+            if(action < 2 && game.can_undo())
+            {
+                TEST_CHECK(game.undo());
+
+                redos.push_back(states.back());
+                states.pop_back();
+                TEST_CHECK(get_state(game) == states.back());
+            }
+            else if(action < 4 && game.can_redo())
+            {
+                TEST_CHECK(game.redo());
+
+                states.push_back(redos.back());
+                redos.pop_back();
+                TEST_CHECK(get_state(game) == states.back());
+            }
+            else
+            {
+                if(!play_turn(game, random))
+                    break;
+
+                redos.clear();
+                states.push_back(get_state(game));
+                TEST_CHECK(!game.can_redo());
+            }
+
+            //------------------------------------------------------------------
+            // Only the newest turns are kept.
+            if(states.size() > k_journal_capacity + 1)
+                states.erase(states.begin());
+
+            auto undos_count = 0u;
+            while(game.can_undo() && undos_count <= k_journal_capacity)
+            {
+                game.undo();
+                ++undos_count;
+            }
+            TEST_CHECK(undos_count == states.size() - 1);
+            TEST_CHECK(get_state(game) == states.front());
+
+            for(auto i = 0u; i < undos_count; ++i)
+                TEST_CHECK(game.redo());
+            TEST_CHECK(get_state(game) == states.back());
+        }
+    }
+}
+
+// Undoing a turn takes back its random numbers too, so the same move
+// gives the same block, and redoing it goes on from where it was.
+void
+test_random_rewind() noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto game  = GameCore(&values_gen, 4, 4, seed);
+        auto other = GameCore(&values_gen, 4, 4, seed);
+        game.set_journal_capacity(k_journal_capacity);
+
+        auto random       = Random(seed);
+        auto other_random = Random(seed);
+        for(auto turn = 0; turn < k_max_turns_count / 5; ++turn)
+        {
+            auto state        = get_state(game);
+            auto moves_random = random;
+            if(!play_turn(game, random))
+                break;
+
+            auto played = get_state(game);
+
+            game.undo();
+            TEST_CHECK(get_state(game) == state);
+
+            random = moves_random;
+            play_turn(game, random);
+            TEST_CHECK(get_state(game) == played);
+
+            game.undo();
+            game.redo();
+            TEST_CHECK(get_state(game) == played);
+
+            // The game that never undid anything.
+            play_turn(other, other_random);
+            TEST_CHECK(get_state(other) == played);
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    for(auto &size : k_sizes)
+    {
+        for(auto engine = 0; engine < 3; ++engine)
+        {
+            test_undo_redo(
+                size[0], size[1], GameCore::MoveEngine(engine)
+            );
+        }
+    }
+
+    test_random_rewind();
+
+    printf(
+        "journal: %d games, %u failures\n",
+        k_games_count * (12 + 1),
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,267 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Differential test of the LineKernel Isas and the move engines.          //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <cstring>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_lines_count      = 300000;
+constexpr auto k_game_lines_every = 16; // Lines also played on the engines.
+constexpr auto k_max_exponent     = 17;
+
+constexpr auto k_line_size = LineKernel::k_max_line_size;
+
+const LineKernel::Isa k_isas[] = {
+    LineKernel::Isa::Scalar,
+    LineKernel::Isa::SSE41,
+    LineKernel::Isa::AVX2,
+};
+
+const GameCore::MoveEngine k_engines[] = {
+    GameCore::MoveEngine::Scan,
+    GameCore::MoveEngine::LineTable,
+    GameCore::MoveEngine::LineKernel,
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// The plain rules, one cell at a time: the blocks go to the cell 0 and
+// each one merges with the block before it, if that one didn't merge.
+void
+move_line_reference(const u8 *p_line, u32 size, u8 *p_result) noexcept
+{
+    std::memset(p_result, 0, k_line_size);
+
+    auto count       = 0u;
+    auto last_merged = true;
+    for(auto i = 0u; i < size; ++i)
+    {
+        if(p_line[i] == 0)
+            continue;
+
+        if(!last_merged && p_result[count -1] == p_line[i])
+        {
+            ++p_result[count -1];
+            last_merged = true;
+            continue;
+        }
+
+        p_result[count++] = p_line[i];
+        last_merged       = false;
+    }
+}
+
+// Runs of equal cells and empty cells, so there are merges of all sorts.
+u32
+create_line(Random &random, u8 *p_line) noexcept
+{
+    std::memset(p_line, 0, k_line_size);
+
+    auto size          = u32(random.next(1, k_line_size));
+    auto empty_chance  = random.next(0, 9);
+    auto high_exponent = random.next(2, k_max_exponent);
+
+    for(auto i = 0u; i < size; ++i)
+    {
+        if(random.next(0, 9) < empty_chance)
+            continue;
+
+        p_line[i] = (i != 0 && random.next(0, 2) == 0 && p_line[i -1])
+            ? p_line[i -1]
+            : u8(random.next(1, high_exponent));
+    }
+
+    return size;
+}
+
+void
+check_same_transition(
+    const u8                     *p_line,
+    const LineKernel::Transition &transition,
+    const LineKernel::Transition &other) noexcept
+{
+    TEST_CHECK(std::memcmp(transition.line, other.line, k_line_size) == 0);
+    TEST_CHECK(transition.moved_mask   == other.moved_mask  );
+    TEST_CHECK(transition.merged_mask  == other.merged_mask );
+    TEST_CHECK(transition.removed_mask == other.removed_mask);
+
+    for(auto i = 0u; i < k_line_size; ++i)
+    {
+        if(p_line[i] != 0)
+            TEST_CHECK(transition.targets[i] == other.targets[i]);
+    }
+}
+
+void
+check_line_table(
+    const u8                     *p_line,
+    const LineKernel::Transition &transition) noexcept
+{
+    auto packed = u16(0);
+    for(auto i = 0u; i < LineTable::k_line_size; ++i)
+        packed |= u16(p_line[i] << (i * 4));
+
+    auto &table_transition = LineTable::get_transition(packed);
+    for(auto i = 0u; i < LineTable::k_line_size; ++i)
+    {
+        auto exponent = (table_transition.line >> (i * 4)) & 0xF;
+        TEST_CHECK(exponent == transition.line[i]);
+
+        if(p_line[i] != 0)
+        {
+            TEST_CHECK(
+                table_transition.get_target(i) == transition.targets[i]
+            );
+        }
+    }
+
+    TEST_CHECK(table_transition.moved_mask   == transition.moved_mask  );
+    TEST_CHECK(table_transition.merged_mask  == transition.merged_mask );
+    TEST_CHECK(table_transition.removed_mask == transition.removed_mask);
+}
+
+// The line as a row and as a column of games, moved by each engine.
+void
+check_engines(
+    IValuesGenerator *p_values_gen,
+    u8               *p_line,
+    u32               size,
+    i32               seed) noexcept
+{
+    for(auto vertical : { false, true })
+    {
+        auto width     = (vertical) ? 1    : size;
+        auto height    = (vertical) ? size : 1;
+        auto direction = (vertical) ? GameCore::Direction::Up
+                                    : GameCore::Direction::Left;
+
+        auto board = GameCore(p_values_gen, width, height, seed);
+        auto coord = acow::math::Coord();
+        for(auto i = 0u; i < size; ++i)
+        {
+            (vertical) ? (coord.y = i) : (coord.x = i);
+            if(p_line[i] != 0 && !board.get_block_at(coord))
+                board.generate_next_block(coord, 1u << p_line[i]);
+        }
+
+        //----------------------------------------------------------------------
+        // The game generated its first block too, so the line is read back.
+        u8 line[k_line_size] = {};
+        for(auto i = 0u; i < size; ++i)
+        {
+            (vertical) ? (coord.y = i) : (coord.x = i);
+            auto p_block = board.get_block_at(coord);
+            line[i] = (p_block) ? u8(__builtin_ctz(p_block->get_value())) : 0;
+        }
+
+        u8 expected[k_line_size];
+        move_line_reference(line, size, expected);
+
+        for(auto engine : k_engines)
+        {
+            auto game = board;
+            game.set_move_engine(engine);
+            game.make_move(direction);
+
+            for(auto i = 0u; i < size; ++i)
+            {
+                (vertical) ? (coord.y = i) : (coord.x = i);
+                auto p_block = game.get_block_at(coord);
+                auto value   = (p_block) ? p_block->get_value() : 0;
+
+                TEST_CHECK(value == ((expected[i]) ? 1u << expected[i] : 0));
+            }
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    for(auto isa : k_isas)
+    {
+        if(!LineKernel::is_isa_supported(isa))
+            printf("line_kernel: Isa %d isn't supported, skipped\n", int(isa));
+    }
+
+    auto values_gen = TestValuesGenerator();
+    auto random     = Random(0);
+
+    u8 line    [k_line_size];
+    u8 expected[k_line_size];
+
+    for(auto i = 0; i < k_lines_count; ++i)
+    {
+        auto size = create_line(random, line);
+        move_line_reference(line, size, expected);
+
+        auto scalar = LineKernel::Transition();
+        LineKernel::move_line(LineKernel::Isa::Scalar, line, &scalar);
+        TEST_CHECK(std::memcmp(scalar.line, expected, k_line_size) == 0);
+
+        for(auto isa : k_isas)
+        {
+            if(!LineKernel::is_isa_supported(isa))
+                continue;
+
+            auto transition = LineKernel::Transition();
+            LineKernel::move_line(isa, line, &transition);
+            check_same_transition(line, transition, scalar);
+        }
+
+        //----------------------------------------------------------------------
+        // The table doesn't merge its max exponent.
+        auto fits_table = size <= LineTable::k_line_size;
+        for(auto j = 0u; j < LineTable::k_line_size; ++j)
+            fits_table &= line[j] < LineTable::k_max_exponent;
+
+        if(fits_table)
+            check_line_table(line, scalar);
+
+        if(i % k_game_lines_every == 0)
+            check_engines(&values_gen, line, size, i);
+    }
+
+    printf(
+        "line_kernel: %d lines, %u failures\n",
+        k_lines_count,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
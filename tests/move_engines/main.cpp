@@ -0,0 +1,215 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that all the move engines yield the same games.                  //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_boards_count = 300;
+constexpr auto k_turns_count  = 40;
+
+const GameCore::MoveEngine k_engines[] = {
+    GameCore::MoveEngine::Scan,
+    GameCore::MoveEngine::LineTable,
+    GameCore::MoveEngine::LineKernel,
+};
+
+// Square boards for the LineTable, lines on both sides of the
+// LineKernel::k_max_line_size for the LineKernel.
+const u32 k_sizes[][2] = {
+    {  4,  4 }, { 4, 7 }, { 7, 4 }, { 3, 3 }, { 8, 8 },
+    { 16, 16 }, { 64, 2 }, { 2, 70 },
+};
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// Random values up to 32768, with pairs of 32768 side by side, that
+// only some engines could merge.
+GameCore
+create_board(
+    IValuesGenerator *p_values_gen,
+    u32               width,
+    u32               height,
+    i32               seed) noexcept
+{
+    auto game   = GameCore(p_values_gen, width, height, seed);
+    auto random = Random(seed);
+
+    auto put = [&](const acow::math::Coord &coord, u32 value) {
+        if(game.is_valid_coord(coord) && !game.get_block_at(coord))
+            game.generate_next_block(coord, value);
+    };
+
+    auto pairs_count = random.next(1, 3);
+    for(auto i = 0; i < pairs_count; ++i)
+    {
+        auto coord = acow::math::Coord();
+        coord.y = random.next(0, height -1);
+        coord.x = random.next(0, width  -1);
+        put(coord, 32768);
+
+        (random.next(0, 1) == 0) ? ++coord.x : ++coord.y;
+        put(coord, 32768);
+    }
+
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(height); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(width); ++coord.x)
+        {
+            if(random.next(0, 3) == 0)
+                continue;
+
+            // Small values are more likely, so there are merges.
+            auto exponent = acow::math::Min(
+                random.next(1, 6) + random.next(0, 1) * random.next(0, 9),
+                15
+            );
+            put(coord, 1u << exponent);
+        }
+    }
+
+    return game;
+}
+
+void
+check_same_game(const GameCore &game, const GameCore &other) noexcept
+{
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(game.get_height()); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(game.get_width()); ++coord.x)
+        {
+            auto p_block       = game .get_block_at(coord);
+            auto p_other_block = other.get_block_at(coord);
+
+            TEST_CHECK(
+                ( p_block ? p_block      ->get_value() : 0) ==
+                (p_other_block ? p_other_block->get_value() : 0)
+            );
+        }
+    }
+
+    TEST_CHECK(game.get_score      () == other.get_score      ());
+    TEST_CHECK(game.get_max_value  () == other.get_max_value  ());
+    TEST_CHECK(game.get_moves_count() == other.get_moves_count());
+    TEST_CHECK(game.get_hash       () == other.get_hash       ());
+    TEST_CHECK(game.get_status     () == other.get_status     ());
+    TEST_CHECK(
+        game.get_empty_cells_count() == other.get_empty_cells_count()
+    );
+}
+
+// Plays the same turns on the board with each engine.
+void
+check_board(GameCore board) noexcept
+{
+    auto games = std::vector<GameCore>();
+    for(auto engine : k_engines)
+    {
+        games.push_back(board);
+        games.back().set_move_engine(engine);
+    }
+
+    auto random = Random(board.get_hash() & 0x7fffffff);
+    for(auto turn = 0; turn < k_turns_count; ++turn)
+    {
+        for(auto d = 0; d < 4; ++d)
+        {
+            auto direction = GameCore::Direction(d);
+            for(auto &game : games)
+            {
+                TEST_CHECK(
+                    game.is_valid_move(direction) ==
+                    games[0].is_valid_move(direction)
+                );
+            }
+        }
+
+        auto direction = GameCore::Direction(random.next(0, 3));
+        auto results   = std::vector<GameCore::MoveResult>();
+        for(auto &game : games)
+            results.push_back(game.make_move(direction));
+
+        for(auto i = 1u; i < games.size(); ++i)
+        {
+            const auto &result = results[i];
+            TEST_CHECK(result.move_valid == results[0].move_valid);
+            TEST_CHECK(
+                result.moved_blocks.size() ==
+                results[0].moved_blocks.size()
+            );
+            TEST_CHECK(
+                result.merged_blocks.size() ==
+                results[0].merged_blocks.size()
+            );
+            TEST_CHECK(
+                result.removed_blocks.size() ==
+                results[0].removed_blocks.size()
+            );
+
+            check_same_game(games[i], games[0]);
+        }
+
+        //----------------------------------------------------------------------
+        // The games are copies, so they draw the same blocks.
+        for(auto i = 0u; i < games.size(); ++i)
+        {
+            if(results[i].move_valid)
+                games[i].generate_next_block();
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto values_gen = TestValuesGenerator();
+    for(const auto &size : k_sizes)
+    {
+        for(auto seed = 0; seed < k_boards_count; ++seed)
+            check_board(create_board(&values_gen, size[0], size[1], seed));
+    }
+
+    printf(
+        "move_engines: %d boards, %u failures\n",
+        int(k_boards_count * (sizeof(k_sizes) / sizeof(k_sizes[0]))),
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
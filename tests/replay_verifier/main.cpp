@@ -0,0 +1,251 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks the verdicts of the ReplayVerifier.                              //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <memory>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+typedef ReplayVerifier::Game    Game;
+typedef ReplayVerifier::Verdict Verdict;
+
+// Only 32768 blocks, so the 4x4 games merge them right away.
+class BigValuesGenerator
+    : public IValuesGenerator
+{
+public:
+    virtual u32
+    generate_value(Random & /* rnd_gen */) noexcept override
+    {
+        return 32768;
+    }
+
+    virtual void
+    set_max_value(u32 /* value */) noexcept override
+    {
+        // Empty...
+    }
+
+    virtual ValuesChances
+    get_values_chances() const noexcept override
+    {
+        return { {32768, 1.0f} };
+    }
+};
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_games_count     = 400;
+constexpr auto k_max_moves_count = 3000;
+
+const u32 k_sizes[][2] = { { 4, 4 }, { 5, 5 }, { 3, 7 } };
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+void
+add_move(Game &game, GameCore::Direction direction) noexcept
+{
+    if(game.moves_count % 4 == 0)
+        game.moves.push_back(0);
+
+    game.moves.back() |= u8(u32(direction) << (game.moves_count % 4 * 2));
+    ++game.moves_count;
+}
+
+// Random valid moves until the defeat, a block after each move.
+Game
+play_game(
+    IValuesGenerator *p_values_gen,
+    u32               width,
+    u32               height,
+    i32               seed) noexcept
+{
+    auto core   = GameCore(p_values_gen, width, height, seed);
+    auto game   = Game{ seed, width, height, 1, {}, 0, 0, 0 };
+    auto random = Random(seed);
+
+    for(auto i = 0; i < k_max_moves_count; ++i)
+    {
+        if(core.get_status() == CoreGame::Status::Defeat)
+            break;
+
+        auto direction = GameCore::Direction(random.next(0, 3));
+        if(!core.make_move(direction).move_valid)
+            continue;
+
+        core.generate_next_block();
+        add_move(game, direction);
+        ++game.blocks_count;
+    }
+
+    game.claimed_score = core.get_score();
+    return game;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+void
+test_verdicts(ReplayVerifier &verifier, u32 width, u32 height) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto game   = play_game(&values_gen, width, height, seed);
+        auto result = verifier.verify_game(game);
+
+        TEST_CHECK(result.verdict     == Verdict::Valid     );
+        TEST_CHECK(result.moves_count == game.moves_count   );
+        TEST_CHECK(result.score       == game.claimed_score );
+
+        //----------------------------------------------------------------------
+        // A score that wasn't made.
+        auto cheat = game;
+        cheat.claimed_score += 2;
+        TEST_CHECK(verifier.verify_game(cheat).verdict ==
+                   Verdict::ScoreMismatch);
+
+        //----------------------------------------------------------------------
+        // A move after the defeat, without its block.
+        if(game.moves_count < k_max_moves_count)
+        {
+            cheat = game;
+            add_move(cheat, GameCore::Direction(seed % 4));
+
+            result = verifier.verify_game(cheat);
+            TEST_CHECK(result.verdict     == Verdict::IllegalMove);
+            TEST_CHECK(result.moves_count == game.moves_count    );
+        }
+
+        //----------------------------------------------------------------------
+        // Games that can't be replayed.
+        cheat = game;
+        cheat.blocks_count += 2;
+        TEST_CHECK(verifier.verify_game(cheat).verdict == Verdict::Malformed);
+
+        cheat = game;
+        cheat.initial_blocks_count = width * height + 1;
+        TEST_CHECK(verifier.verify_game(cheat).verdict == Verdict::Malformed);
+
+        cheat = game;
+        cheat.width = 0;
+        TEST_CHECK(verifier.verify_game(cheat).verdict == Verdict::Malformed);
+    }
+}
+
+// The BitBoard can't merge two 32768, the GameCore that the
+// game was played on did.
+void
+test_32768_merges() noexcept
+{
+    auto values_gen = BigValuesGenerator();
+    auto verifier   = ReplayVerifier([]() {
+        return std::make_shared<BigValuesGenerator>();
+    });
+
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto game   = play_game(&values_gen, 4, 4, seed);
+        auto result = verifier.verify_game(game);
+
+        TEST_CHECK(game.moves_count != 0);
+        TEST_CHECK(result.verdict     == Verdict::Valid  );
+        TEST_CHECK(result.moves_count == game.moves_count);
+    }
+}
+
+// The same verdicts from the batches, on a ThreadPool.
+void
+test_batches() noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    auto games      = std::vector<Game>();
+
+    for(auto seed = 0; seed < k_games_count * 3; ++seed)
+    {
+        games.push_back(play_game(&values_gen, 4, 4, seed));
+        if(seed % 3 == 0)
+            games.back().claimed_score += 4;
+    }
+
+    ThreadPool pool(2);
+    auto verifier = ReplayVerifier([]() {
+        return std::make_shared<TestValuesGenerator>();
+    });
+    verifier.set_thread_pool(&pool);
+
+    auto results  = std::vector<ReplayVerifier::Result>();
+    auto counters = verifier.verify(games, &results);
+
+    TEST_CHECK(results.size()       == games.size());
+    TEST_CHECK(counters.games_count == games.size());
+    TEST_CHECK(counters.verdicts_counts[u32(Verdict::ScoreMismatch)] ==
+               u64(k_games_count));
+    TEST_CHECK(counters.verdicts_counts[u32(Verdict::Valid)] ==
+               u64(k_games_count * 2));
+
+    for(auto i = 0u; i < games.size(); ++i)
+    {
+        TEST_CHECK(results[i].verdict == ((i % 3 == 0)
+            ? Verdict::ScoreMismatch
+            : Verdict::Valid));
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    auto verifier = ReplayVerifier([]() {
+        return std::make_shared<TestValuesGenerator>();
+    });
+
+    for(auto &size : k_sizes)
+        test_verdicts(verifier, size[0], size[1]);
+
+    test_32768_merges();
+    test_batches();
+
+    printf(
+        "replay_verifier: %d games, %u failures\n",
+        k_games_count * 5,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,267 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that the sessions play like their own GameCores.                 //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <memory>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+typedef SessionHost::SessionId   SessionId;
+typedef SessionHost::Move        Move;
+typedef SessionHost::MoveOutcome MoveOutcome;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_sessions_count = 100u;
+constexpr auto k_shards_count   = 8u;
+constexpr auto k_batches_count  = 50;
+constexpr auto k_batch_size     = 400u;
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+std::shared_ptr<IValuesGenerator>
+make_generator() noexcept
+{
+    return std::make_shared<TestValuesGenerator>();
+}
+
+// The games that the sessions must be, played on their own.
+struct Session
+{
+    SessionId                 session_id;
+    std::unique_ptr<GameCore> p_game;
+};
+
+std::vector<Session>
+create_sessions(SessionHost &host, IValuesGenerator *p_values_gen) noexcept
+{
+    auto sessions = std::vector<Session>();
+    for(auto i = 0u; i < k_sessions_count; ++i)
+    {
+        auto width  = 3 + i % 4;
+        auto height = 3 + i % 3;
+        auto seed   = i32(i);
+
+        auto session_id = host.create(width, height, seed);
+        TEST_CHECK(session_id != SessionHost::k_invalid_session_id);
+
+        sessions.push_back(Session{
+            session_id,
+            std::unique_ptr<GameCore>(
+                new GameCore(p_values_gen, width, height, seed)
+            )
+        });
+    }
+
+    return sessions;
+}
+
+// Plays the move like the host does and checks the outcome of it.
+void
+check_move(GameCore &game, GameCore::Direction direction,
+           const MoveOutcome &outcome) noexcept
+{
+    auto move_valid = game.make_move(direction).move_valid;
+    if(move_valid)
+        game.generate_next_block();
+
+    TEST_CHECK(outcome.session_found);
+    TEST_CHECK(outcome.move_valid  == move_valid            );
+    TEST_CHECK(outcome.moves_count == game.get_moves_count());
+    TEST_CHECK(outcome.score       == game.get_score      ());
+    TEST_CHECK(outcome.hash        == game.get_hash       ());
+    TEST_CHECK(outcome.status      == game.get_status     ());
+}
+
+// The snapshots of the sessions are the states of theirs games.
+void
+check_snapshots(SessionHost &host, std::vector<Session> &sessions) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto &session : sessions)
+    {
+        auto snapshot = GameCore::Snapshot();
+        TEST_CHECK(host.snapshot(session.session_id, &snapshot));
+
+        auto &game    = *session.p_game;
+        auto restored = GameCore(
+            &values_gen, game.get_width(), game.get_height()
+        );
+        restored.restore(snapshot);
+
+        TEST_CHECK(restored.ascii          () == game.ascii          ());
+        TEST_CHECK(restored.get_score      () == game.get_score      ());
+        TEST_CHECK(restored.get_moves_count() == game.get_moves_count());
+        TEST_CHECK(restored.get_hash       () == game.get_hash       ());
+
+        // And they go on with the same blocks.
+        for(auto direction = 0; direction < 4; ++direction)
+        {
+            auto d = GameCore::Direction(direction);
+            if(!game.is_valid_move(d))
+                continue;
+
+            auto fork = GameCore(
+                &values_gen, game.get_width(), game.get_height()
+            );
+            game.fork(&fork);
+
+            fork    .make_move(d);
+            restored.make_move(d);
+            fork    .generate_next_block();
+            restored.generate_next_block();
+            TEST_CHECK(restored.ascii() == fork.ascii());
+            break;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// Moves one by one, from this thread.
+void
+test_apply_move() noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    SessionHost host(make_generator, k_shards_count);
+
+    auto sessions = create_sessions(host, &values_gen);
+    TEST_CHECK(host.get_sessions_count() == k_sessions_count);
+    TEST_CHECK(host.get_shards_count  () == k_shards_count  );
+
+    auto random = Random(1);
+    for(auto i = 0; i < k_batches_count * 100; ++i)
+    {
+        auto &session   = sessions[random.next(0, k_sessions_count - 1)];
+        auto  direction = GameCore::Direction(random.next(0, 3));
+
+        auto outcome = host.apply_move(session.session_id, direction);
+        check_move(*session.p_game, direction, outcome);
+    }
+
+    check_snapshots(host, sessions);
+
+    //--------------------------------------------------------------------------
+    // Closed sessions are gone.
+    auto session_id = sessions.back().session_id;
+    TEST_CHECK( host.close(session_id));
+    TEST_CHECK(!host.close(session_id));
+    TEST_CHECK(host.get_sessions_count() == k_sessions_count - 1);
+
+    auto snapshot = GameCore::Snapshot();
+    TEST_CHECK(!host.snapshot(session_id, &snapshot));
+    TEST_CHECK(!host.apply_move(session_id, GameCore::Direction::Left)
+                   .session_found);
+    TEST_CHECK(!host.apply_move(SessionHost::k_invalid_session_id,
+                                GameCore::Direction::Left).session_found);
+
+    // Ids aren't reused.
+    auto new_session_id = host.create(4, 4, 0);
+    for(auto &session : sessions)
+        TEST_CHECK(new_session_id != session.session_id);
+}
+
+// Batches with many moves of the same sessions, which must be applied
+// in the order they were given, with and without the threads.
+void
+test_apply_moves(ThreadPool *p_pool) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    SessionHost host(make_generator, k_shards_count);
+
+    host.set_thread_pool(p_pool);
+
+    auto sessions = create_sessions(host, &values_gen);
+    auto random   = Random(2);
+    auto moves    = std::vector<Move>();
+    auto outcomes = std::vector<MoveOutcome>();
+    auto indexes  = std::vector<u32>();
+
+    for(auto batch = 0; batch < k_batches_count; ++batch)
+    {
+        moves  .clear();
+        indexes.clear();
+        for(auto i = 0u; i < k_batch_size; ++i)
+        {
+            auto index = u32(random.next(0, k_sessions_count - 1));
+            moves.push_back(Move{
+                sessions[index].session_id,
+                GameCore::Direction(random.next(0, 3))
+            });
+            indexes.push_back(index);
+        }
+
+        // A session that doesn't exist.
+        moves.push_back(Move{
+            SessionHost::k_invalid_session_id, GameCore::Direction::Up
+        });
+
+        host.apply_moves(moves, &outcomes);
+        TEST_CHECK(outcomes.size() == moves.size());
+
+        for(auto i = 0u; i < k_batch_size; ++i)
+        {
+            auto &game = *sessions[indexes[i]].p_game;
+            check_move(game, moves[i].direction, outcomes[i]);
+        }
+        TEST_CHECK(!outcomes.back().session_found);
+    }
+
+    check_snapshots(host, sessions);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    test_apply_move ();
+    test_apply_moves(nullptr);
+
+    ThreadPool pool(2);
+    test_apply_moves(&pool);
+
+    printf(
+        "session_host: %u games, %u failures\n",
+        k_sessions_count * 3,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
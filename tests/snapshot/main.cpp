@@ -0,0 +1,209 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks that snapshot(), restore() and fork() give back the exact games. //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_games_count     = 40;
+constexpr auto k_max_turns_count = 400;
+constexpr auto k_branch_turns    = 8;
+
+const u32 k_sizes[][2] = { { 4, 4 }, { 5, 3 }, { 8, 8 }, { 3, 17 } };
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// What the players see of a game.
+struct GameState
+{
+    std::vector<u32> values;
+
+    u32              score;
+    u32              max_value;
+    u32              moves_count;
+    u64              hash;
+    CoreGame::Status status;
+    u32              empty_cells_count;
+
+    bool
+    operator==(const GameState &other) const noexcept
+    {
+        return values            == other.values
+            && score             == other.score
+            && max_value         == other.max_value
+            && moves_count       == other.moves_count
+            && hash              == other.hash
+            && status            == other.status
+            && empty_cells_count == other.empty_cells_count;
+    }
+};
+
+GameState
+get_state(const GameCore &game) noexcept
+{
+    auto state = GameState{
+        {},
+        game.get_score            (),
+        game.get_max_value        (),
+        game.get_moves_count      (),
+        game.get_hash             (),
+        game.get_status           (),
+        game.get_empty_cells_count()
+    };
+
+    auto coord = acow::math::Coord();
+    for(coord.y = 0; coord.y < int(game.get_height()); ++coord.y)
+    {
+        for(coord.x = 0; coord.x < int(game.get_width()); ++coord.x)
+        {
+            auto p_block = game.get_block_at(coord);
+            state.values.push_back((p_block) ? p_block->get_value() : 0);
+        }
+    }
+
+    return state;
+}
+
+// Makes a random valid move and its block, false if there's none.
+bool
+play_turn(GameCore &game, Random &random) noexcept
+{
+    for(auto i = 0; i < 16; ++i)
+    {
+        auto direction = GameCore::Direction(random.next(0, 3));
+        if(!game.make_move(direction).move_valid)
+            continue;
+
+        game.generate_next_block();
+        return true;
+    }
+
+    return false;
+}
+
+// Plays the same turns that gave the states, the blocks must be the
+// same too since the random of the game was brought back.
+void
+check_branch(
+    GameCore                     &game,
+    Random                        random,
+    const std::vector<GameState> &states) noexcept
+{
+    for(auto &state : states)
+    {
+        play_turn(game, random);
+        TEST_CHECK(get_state(game) == state);
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// Along a game, branches a few turns ahead and brings back the state
+// with restore() on the same game, restore() on another game and fork().
+void
+test_snapshots(u32 width, u32 height) noexcept
+{
+    auto values_gen = TestValuesGenerator();
+    for(auto seed = 0; seed < k_games_count; ++seed)
+    {
+        auto game   = GameCore(&values_gen, width, height, seed);
+        auto other  = GameCore(&values_gen, width, height, seed + 1);
+        auto forked = GameCore(&values_gen, width, height, seed + 2);
+
+        auto random = Random(seed);
+        for(auto turn = 0; turn < k_max_turns_count; ++turn)
+        {
+            auto snapshot = game.snapshot();
+            auto state    = get_state(game);
+
+            TEST_CHECK(snapshot.width  == width);
+            TEST_CHECK(snapshot.height == height);
+
+            //------------------------------------------------------------------
+            // The branch.
+            auto branch_random = random;
+            auto states        = std::vector<GameState>();
+            for(auto i = 0; i < k_branch_turns; ++i)
+            {
+                if(!play_turn(game, branch_random))
+                    break;
+
+                states.push_back(get_state(game));
+            }
+
+            //------------------------------------------------------------------
+            // Back on the same game.
+            game.restore(snapshot);
+            TEST_CHECK(get_state(game) == state);
+            check_branch(game, random, states);
+
+            //------------------------------------------------------------------
+            // On a game that was somewhere else.
+            other.restore(snapshot);
+            TEST_CHECK(get_state(other) == state);
+            check_branch(other, random, states);
+
+            //------------------------------------------------------------------
+            // Forked, which must not touch the game it came from.
+            game.restore(snapshot);
+            game.fork(&forked);
+            TEST_CHECK(get_state(forked) == state);
+            check_branch(forked, random, states);
+            TEST_CHECK(get_state(game) == state);
+
+            if(!play_turn(game, random))
+                break;
+        }
+    }
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    for(auto &size : k_sizes)
+        test_snapshots(size[0], size[1]);
+
+    printf(
+        "snapshot: %d games, %u failures\n",
+        k_games_count * 4,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,270 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Checks the alias tables and the binary files of the ValuesTable.        //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <vector>
+// Core2048
+#include "Core2048/Core2048.h"
+#include "tests/TestUtils.h"
+
+// Usings
+USING_NS_CORE2048;
+
+
+//----------------------------------------------------------------------------//
+// Types                                                                      //
+//----------------------------------------------------------------------------//
+typedef ValuesTable::Entry Entry;
+
+
+//----------------------------------------------------------------------------//
+// Constants                                                                  //
+//----------------------------------------------------------------------------//
+constexpr auto k_rows_count  = 500;
+constexpr auto k_draws_count = 200000;
+
+// Drawn chances are off by about 1 / sqrt(k_draws_count).
+constexpr auto k_draws_tolerance = 0.01;
+
+constexpr auto k_text_filename   = "resources/values.txt";
+constexpr auto k_binary_filename = "values_table_test.bin";
+
+
+//----------------------------------------------------------------------------//
+// Helper Functions                                                           //
+//----------------------------------------------------------------------------//
+// The chance of each value on the columns of the alias table.
+std::map<u32, f64>
+get_alias_chances(const Entry *p_entries, u32 count) noexcept
+{
+    auto chances = std::map<u32, f64>();
+    for(auto i = 0u; i < count; ++i)
+    {
+        auto &entry = p_entries[i];
+        auto  given = f64(entry.threshold) / ValuesTable::k_alias_precision;
+
+        chances[entry.value      ] += given / count;
+        chances[entry.alias_value] += (1.0 - given) / count;
+    }
+
+    return chances;
+}
+
+// The chances that the values are drawn with.
+std::map<u32, f64>
+get_drawn_chances(const Entry *p_entries, u32 count, Random &random) noexcept
+{
+    auto chances = std::map<u32, f64>();
+    for(auto i = 0; i < k_draws_count; ++i)
+        chances[ValuesTable::draw_value(p_entries, count, random)] += 1.0;
+
+    for(auto &chance : chances)
+        chance.second /= k_draws_count;
+
+    return chances;
+}
+
+// Same values with chances close enough.
+bool
+are_close(
+    const std::map<u32, f64> &chances,
+    const std::map<u32, f64> &expected,
+    f64                       tolerance) noexcept
+{
+    for(auto &chance : chances)
+    {
+        auto it = expected.find(chance.first);
+        auto p  = (it != expected.end()) ? it->second : 0.0;
+        if(std::fabs(chance.second - p) > tolerance)
+            return false;
+    }
+
+    for(auto &chance : expected)
+    {
+        if(chance.second > tolerance && chances.count(chance.first) == 0)
+            return false;
+    }
+
+    return true;
+}
+
+
+//----------------------------------------------------------------------------//
+// Tests                                                                      //
+//----------------------------------------------------------------------------//
+// Rows of random percentages, that don't sum up to 100 on purpose.
+void
+test_alias_entries() noexcept
+{
+    auto random = Random(3);
+    for(auto row = 0; row < k_rows_count; ++row)
+    {
+        auto count    = u32(random.next(1, 12));
+        auto values   = std::vector<u32>(count);
+        auto percents = std::vector<u32>(count);
+        auto expected = std::map<u32, f64>();
+        auto total    = 0.0;
+
+        for(auto i = 0u; i < count; ++i)
+        {
+            values  [i] = 2u << i;
+            percents[i] = u32(random.next((i == 0) ? 1 : 0, 100));
+            total      += percents[i];
+        }
+        for(auto i = 0u; i < count; ++i)
+            expected[values[i]] = percents[i] / total;
+
+        auto entries = std::vector<Entry>(count);
+        auto weights = std::vector<u64  >(count);
+        auto indices = std::vector<u32  >(count);
+        ValuesTable::build_alias_entries(
+            values.data(),
+            percents.data(),
+            count,
+            entries.data(),
+            weights.data(),
+            indices.data()
+        );
+
+        //----------------------------------------------------------------------
+        // Exact up to the precision of the thresholds.
+        auto precision = f64(count) / ValuesTable::k_alias_precision;
+        TEST_CHECK(are_close(
+            get_alias_chances(entries.data(), count), expected, precision
+        ));
+
+        for(auto &entry : entries)
+        {
+            TEST_CHECK(entry.threshold <= ValuesTable::k_alias_precision);
+            TEST_CHECK(std::fabs(
+                entry.chance - expected[entry.value]
+            ) < 1e-6);
+        }
+
+        //----------------------------------------------------------------------
+        // And the draws give them.
+        if(row % 25 == 0)
+        {
+            TEST_CHECK(are_close(
+                get_drawn_chances(entries.data(), count, random),
+                expected,
+                k_draws_tolerance
+            ));
+        }
+    }
+}
+
+// A binary table is the same table of the text, shared while it's alive.
+void
+test_binary() noexcept
+{
+    auto p_text = ValuesTable::load_text(k_text_filename);
+    TEST_CHECK(!p_text->is_mapped());
+    TEST_CHECK(p_text->save_binary(k_binary_filename));
+
+    auto p_binary = ValuesTable::load(k_binary_filename);
+    TEST_CHECK(p_binary && p_binary->is_mapped());
+    if(!p_binary)
+        return;
+
+    TEST_CHECK(p_binary->get_checksum() == p_text->get_checksum());
+    TEST_CHECK(ValuesTable::load_binary(k_binary_filename) == p_binary);
+
+    //--------------------------------------------------------------------------
+    // Same rows, that draw the same values.
+    auto random = Random(4);
+    for(auto max_value = 2u; max_value != 0; max_value <<= 1)
+    {
+        auto p_text_row   = p_text  ->get_row(max_value);
+        auto p_binary_row = p_binary->get_row(max_value);
+
+        TEST_CHECK((p_text_row == nullptr) == (p_binary_row == nullptr));
+        if(!p_text_row || !p_binary_row)
+            continue;
+
+        auto count = p_text_row->entries_count;
+        TEST_CHECK(p_binary_row->entries_count == count);
+
+        auto p_text_entries   = p_text  ->get_entries(p_text_row);
+        auto p_binary_entries = p_binary->get_entries(p_binary_row);
+        TEST_CHECK(memcmp(
+            p_text_entries, p_binary_entries, sizeof(Entry) * count
+        ) == 0);
+
+        auto text_random   = random;
+        auto binary_random = random;
+        for(auto i = 0; i < 1000; ++i)
+        {
+            TEST_CHECK(
+                ValuesTable::draw_value(p_text_entries, count, text_random)
+             == ValuesTable::draw_value(p_binary_entries, count, binary_random)
+            );
+        }
+
+        //----------------------------------------------------------------------
+        // The values have the chances of the text.
+        auto expected = std::map<u32, f64>();
+        for(auto i = 0u; i < count; ++i)
+            expected[p_text_entries[i].value] += p_text_entries[i].chance;
+
+        TEST_CHECK(are_close(
+            get_drawn_chances(p_binary_entries, count, random),
+            expected,
+            k_draws_tolerance
+        ));
+    }
+
+    //--------------------------------------------------------------------------
+    // Saving again leaves the mapped table as it was, and it's another
+    // file for the next loads.
+    auto checksum = p_binary->get_checksum();
+    TEST_CHECK(p_text->save_binary(k_binary_filename));
+    TEST_CHECK(p_binary->get_checksum() == checksum);
+
+    auto p_saved = ValuesTable::load_binary(k_binary_filename);
+    TEST_CHECK(p_saved && p_saved != p_binary);
+    TEST_CHECK(p_saved && p_saved->get_checksum() == checksum);
+
+    std::remove(k_binary_filename);
+}
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+int
+main()
+{
+    test_alias_entries();
+    test_binary       ();
+
+    printf(
+        "values_table: %d rows, %u failures\n",
+        k_rows_count,
+        get_failures_count()
+    );
+
+    return (get_failures_count() != 0) ? 1 : 0;
+}
@@ -0,0 +1,58 @@
+//~---------------------------------------------------------------------------//
+//                     _______  _______  _______  _     _                     //
+//                    |   _   ||       ||       || | _ | |                    //
+//                    |  |_|  ||       ||   _   || || || |                    //
+//                    |       ||       ||  | |  ||       |                    //
+//                    |       ||      _||  |_|  ||       |                    //
+//                    |   _   ||     |_ |       ||   _   |                    //
+//                    |__| |__||_______||_______||__| |__|                    //
+//                             www.amazingcow.com                             //
+//  File      : main.cpp                                                      //
+//  Project   : Core2048                                                      //
+//  Date      : Oct 17, 2026                                                  //
+//  License   : GPLv3                                                         //
+//  Author    : n2omatt <n2omatt@amazingcow.com>                              //
+//  Copyright : AmazingCow - 2026                                             //
+//                                                                            //
+//  Description :                                                             //
+//    Compiles a text values table into the binary format.                    //
+//                                                                            //
+//---------------------------------------------------------------------------~//
+
+// std
+#include <cstdio>
+// Core2048
+#include "Core2048/Core2048.h"
+
+
+//----------------------------------------------------------------------------//
+// Entry Point                                                                //
+//----------------------------------------------------------------------------//
+// Usage: Core2048_values_compiler <values_file> <binary_file>
+//   values_file - The text table, like resources/values.txt
+//   binary_file - Where the compiled table is written.
+int
+main(int argc, const char *argv[])
+{
+    if(argc != 3)
+    {
+        fprintf(stderr, "Usage: %s <values_file> <binary_file>\n", argv[0]);
+        return 1;
+    }
+
+    auto p_table = Core2048::ValuesTable::load_text(argv[1]);
+    if(!p_table || !p_table->save_binary(argv[2]))
+    {
+        fprintf(stderr, "Cannot compile (%s) into (%s)\n", argv[1], argv[2]);
+        return 1;
+    }
+
+    // Load it back so broken files are caught here.
+    if(!Core2048::ValuesTable::load_binary(argv[2]))
+    {
+        fprintf(stderr, "Cannot load the compiled (%s)\n", argv[2]);
+        return 1;
+    }
+
+    return 0;
+}